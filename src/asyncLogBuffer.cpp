@@ -0,0 +1,512 @@
+// File:  asyncLogBuffer.cpp
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Copy:  (c) Copyright 2026
+// Desc:  Stream buffer that moves file I/O off the calling thread.  Output is
+//        collected into page-sized blocks, which are handed to a writer thread
+//        through lock-free queues.  Flushing the stream (e.g. std::endl) does
+//        not cause any I/O; partially filled blocks are handed off once the
+//        flush interval has elapsed, or when a sync is requested (which also
+//        calls fdatasync).  Only one thread may write to the stream or call
+//        Open(), Close() and RequestSync().  That thread never blocks on file
+//        I/O - if every block is waiting to be written, new output is
+//        discarded and counted.
+
+// Standard C++ headers
+#include <cassert>
+#include <cerrno>
+#include <cstring>
+
+// *nix headers
+#include <unistd.h>
+#include <fcntl.h>
+
+// Local headers
+#include "asyncLogBuffer.h"
+#include "monotonicClock.h"
+#include "workerThread.h"
+
+//==========================================================================
+// Class:			AsyncLogBuffer
+// Function:		Constant definitions
+//
+// Description:		Constant definitions for AsyncLogBuffer class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+const unsigned int AsyncLogBuffer::blockSize = 4096;
+const unsigned int AsyncLogBuffer::blockCount = 16;
+const unsigned int AsyncLogBuffer::requestQueueSize = 32;
+
+//==========================================================================
+// Class:			AsyncLogBuffer
+// Function:		AsyncLogBuffer
+//
+// Description:		Constructor for AsyncLogBuffer class.  All memory is
+//					allocated here.
+//
+// Input Arguments:
+//		outStream	= std::ostream&, for error messages
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+AsyncLogBuffer::AsyncLogBuffer(std::ostream &outStream) : outStream(outStream),
+	requests(requestQueueSize), freeBlocks(blockCount)
+{
+	assert(requestQueueSize > blockCount);
+
+	blockMemory = new char[blockSize * blockCount];
+	unsigned int i;
+	for (i = 0; i < blockCount; i++)
+		freeBlocks.Push(blockMemory + i * blockSize);
+
+	current = NULL;
+	setp(NULL, NULL);
+
+	fd = -1;
+	flushInterval = 0.0;
+	lastHandOffTime = 0.0;
+	droppedBytes = 0;
+
+	sem_init(&wakeSemaphore, 0, 0);
+	sem_init(&idleSemaphore, 0, 0);
+	writerRunning = false;
+	continueRunning = false;
+}
+
+//==========================================================================
+// Class:			AsyncLogBuffer
+// Function:		~AsyncLogBuffer
+//
+// Description:		Destructor for AsyncLogBuffer class.  Closes the file and
+//					stops the writer thread once all data has been written.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+AsyncLogBuffer::~AsyncLogBuffer()
+{
+	Close();
+
+	continueRunning = false;
+	int errorNumber;
+	if (writerRunning)
+	{
+		sem_post(&wakeSemaphore);
+		if ((errorNumber = pthread_join(writerThread, NULL)) != 0)
+			outStream << "Error joining log writer thread (" << errorNumber << ")" << std::endl;
+	}
+
+	sem_destroy(&wakeSemaphore);
+	sem_destroy(&idleSemaphore);
+
+	delete [] blockMemory;
+}
+
+//==========================================================================
+// Class:			friend of AsyncLogBuffer
+// Function:		LaunchLogWriterThread
+//
+// Description:		Writer thread entry point (launches member function).
+//
+// Input Arguments:
+//		pThisBuffer =	void* (really a pointer to an AsyncLogBuffer)
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		void*
+//
+//==========================================================================
+void *LaunchLogWriterThread(void *pThisBuffer)
+{
+	static_cast<AsyncLogBuffer*>(pThisBuffer)->WriterThreadEntry();
+	return NULL;
+}
+
+//==========================================================================
+// Class:			AsyncLogBuffer
+// Function:		Start
+//
+// Description:		Spawns the writer thread.  The new thread inherits the
+//					scheduling policy of the caller, so this should be called
+//					before the control thread enters real-time mode.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool AsyncLogBuffer::Start(void)
+{
+	assert(!writerRunning);
+
+	continueRunning = true;
+	int errorNumber;
+	if ((errorNumber = WorkerThread::Create(writerThread, &LaunchLogWriterThread, (void*)this)) == 0)
+	{
+		writerRunning = true;
+		return true;
+	}
+
+	outStream << "Failed to spawn log writer thread (" << errorNumber << ")" << std::endl;
+	continueRunning = false;
+	return false;
+}
+
+//==========================================================================
+// Class:			AsyncLogBuffer
+// Function:		Open
+//
+// Description:		Closes any open file and opens (truncates) the specified
+//					file for output.
+//
+// Input Arguments:
+//		fileName		= const std::string&
+//		flushInterval	= const double&, maximum time partially filled blocks
+//						  are held before being written [sec]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool AsyncLogBuffer::Open(const std::string &fileName, const double &flushInterval)
+{
+	assert(writerRunning);
+
+	Close();
+
+	fd = open(fileName.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (fd == -1)
+	{
+		outStream << "Failed to open '" << fileName << "' for output:  " << strerror(errno) << std::endl;
+		return false;
+	}
+
+	this->flushInterval = flushInterval;
+	lastHandOffTime = MonotonicClock::GetTime();
+	droppedBytes = 0;
+
+	return true;
+}
+
+//==========================================================================
+// Class:			AsyncLogBuffer
+// Function:		Close
+//
+// Description:		Hands off any buffered output and asks the writer thread
+//					to sync and close the file.  Does not block, unless asked
+//					to wait until the file has been closed (e.g. so it can be
+//					read back).
+//
+// Input Arguments:
+//		waitForWriter	= const bool&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void AsyncLogBuffer::Close(const bool &waitForWriter)
+{
+	if (!IsOpen())
+		return;
+
+	if (droppedBytes > 0)
+		outStream << "Warning:  " << droppedBytes << " bytes were discarded from log (writer could not keep up)" << std::endl;
+
+	if (!HandOff(true, true, waitForWriter))
+	{
+		// Should never happen, but if it does, don't leak the descriptor
+		outStream << "Log writer request queue is full; closing file without writing remaining data" << std::endl;
+		close(fd);
+	}
+	else if (waitForWriter)
+	{
+		while (sem_wait(&idleSemaphore) != 0 && errno == EINTR)
+			;
+	}
+
+	fd = -1;
+}
+
+//==========================================================================
+// Class:			AsyncLogBuffer
+// Function:		RequestSync
+//
+// Description:		Hands off any buffered output and asks the writer thread
+//					to fdatasync the file once it has been written.  Does not
+//					block.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void AsyncLogBuffer::RequestSync(void)
+{
+	if (IsOpen() && !HandOff(true, false, false))
+		outStream << "Log writer request queue is full; sync skipped" << std::endl;
+}
+
+//==========================================================================
+// Class:			AsyncLogBuffer
+// Function:		overflow
+//
+// Description:		Called by std::streambuf when the current block is full
+//					(or when there is no current block).  Hands off the full
+//					block and starts a new one.
+//
+// Input Arguments:
+//		c	= int_type, character that did not fit
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		int_type, anything other than eof for success
+//
+//==========================================================================
+AsyncLogBuffer::int_type AsyncLogBuffer::overflow(int_type c)
+{
+	if (!IsOpen())
+		return traits_type::not_eof(c);
+
+	if (current && pptr() == epptr())
+		HandOff(false, false, false);
+
+	if (!GetCurrentBlock())
+	{
+		// Report success anyway - we don't want the stream to stop working
+		if (!traits_type::eq_int_type(c, traits_type::eof()))
+			droppedBytes++;
+		return traits_type::not_eof(c);
+	}
+
+	if (!traits_type::eq_int_type(c, traits_type::eof()))
+	{
+		*pptr() = traits_type::to_char_type(c);
+		pbump(1);
+	}
+
+	return traits_type::not_eof(c);
+}
+
+//==========================================================================
+// Class:			AsyncLogBuffer
+// Function:		sync
+//
+// Description:		Called when the stream is flushed.  Only hands off the
+//					current block if the flush interval has elapsed.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		int, 0 for success
+//
+//==========================================================================
+int AsyncLogBuffer::sync(void)
+{
+	if (current && pptr() > pbase() &&
+		MonotonicClock::GetElapsedTime(lastHandOffTime) >= flushInterval)
+		HandOff(false, false, false);
+
+	return 0;
+}
+
+//==========================================================================
+// Class:			AsyncLogBuffer
+// Function:		GetCurrentBlock
+//
+// Description:		Makes sure there is a block to write into, if one is free.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if there is a current block, false otherwise
+//
+//==========================================================================
+bool AsyncLogBuffer::GetCurrentBlock(void)
+{
+	if (!current && freeBlocks.Pop(current))
+		setp(current, current + blockSize);
+
+	return current != NULL;
+}
+
+//==========================================================================
+// Class:			AsyncLogBuffer
+// Function:		HandOff
+//
+// Description:		Passes the current block (if any) to the writer thread,
+//					along with any additional actions to take after writing.
+//
+// Input Arguments:
+//		syncAfterWrite	= const bool&
+//		closeAfterWrite	= const bool&
+//		notify			= const bool&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if the request was queued, false otherwise
+//
+//==========================================================================
+bool AsyncLogBuffer::HandOff(const bool &syncAfterWrite,
+	const bool &closeAfterWrite, const bool &notify)
+{
+	WriteRequest request;
+	request.block = current;
+	request.length = current ? pptr() - pbase() : 0;
+	request.fd = fd;
+	request.sync = syncAfterWrite;
+	request.close = closeAfterWrite;
+	request.notify = notify;
+
+	// There are never more blocks than queue slots, so requests carrying
+	// data always fit
+	if (!requests.Push(request))
+		return false;
+
+	current = NULL;
+	setp(NULL, NULL);
+	lastHandOffTime = MonotonicClock::GetTime();
+
+	sem_post(&wakeSemaphore);
+	return true;
+}
+
+//==========================================================================
+// Class:			AsyncLogBuffer
+// Function:		WriterThreadEntry
+//
+// Description:		Main loop for the writer thread.  Sleeps until woken, then
+//					processes all queued requests.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void AsyncLogBuffer::WriterThreadEntry(void)
+{
+	WriteRequest request;
+	bool stop;
+	while (true)
+	{
+		if (sem_wait(&wakeSemaphore) != 0)
+		{
+			if (errno == EINTR)
+				continue;
+			outStream << "Log writer thread failed to wait for requests:  " << strerror(errno) << std::endl;
+			break;
+		}
+
+		// Anything queued before we were told to stop is still written
+		stop = !continueRunning;
+		__sync_synchronize();
+
+		while (requests.Pop(request))
+			ProcessRequest(request);
+
+		if (stop)
+			break;
+	}
+}
+
+//==========================================================================
+// Class:			AsyncLogBuffer
+// Function:		ProcessRequest
+//
+// Description:		Writes the block (if any) and performs the requested
+//					actions.  The block is returned to the free list.
+//
+// Input Arguments:
+//		request	= const WriteRequest&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void AsyncLogBuffer::ProcessRequest(const WriteRequest &request)
+{
+	unsigned int written(0);
+	ssize_t result;
+	while (written < request.length)
+	{
+		result = write(request.fd, request.block + written, request.length - written);
+		if (result < 0)
+		{
+			if (errno == EINTR)
+				continue;
+			outStream << "Failed to write to log:  " << strerror(errno) << std::endl;
+			break;
+		}
+		written += result;
+	}
+
+	if (request.block)
+		freeBlocks.Push(request.block);
+
+	if (request.sync && fdatasync(request.fd) != 0)
+		outStream << "Failed to sync log:  " << strerror(errno) << std::endl;
+
+	if (request.close && close(request.fd) != 0)
+		outStream << "Failed to close log:  " << strerror(errno) << std::endl;
+
+	if (request.notify)
+		sem_post(&idleSemaphore);
+}
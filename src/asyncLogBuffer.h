@@ -0,0 +1,98 @@
+// File:  asyncLogBuffer.h
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Copy:  (c) Copyright 2026
+// Desc:  Stream buffer that moves file I/O off the calling thread.  Output is
+//        collected into page-sized blocks, which are handed to a writer thread
+//        through lock-free queues.  Flushing the stream (e.g. std::endl) does
+//        not cause any I/O; partially filled blocks are handed off once the
+//        flush interval has elapsed, or when a sync is requested (which also
+//        calls fdatasync).  Only one thread may write to the stream or call
+//        Open(), Close() and RequestSync().  That thread never blocks on file
+//        I/O - if every block is waiting to be written, new output is
+//        discarded and counted.
+
+#ifndef ASYNC_LOG_BUFFER_H_
+#define ASYNC_LOG_BUFFER_H_
+
+// Standard C++ headers
+#include <streambuf>
+#include <string>
+#include <iostream>
+
+// *nix headers
+#include <pthread.h>
+#include <semaphore.h>
+
+// Local headers
+#include "spscQueue.h"
+
+class AsyncLogBuffer : public std::streambuf
+{
+public:
+	AsyncLogBuffer(std::ostream &outStream = std::cout);
+	virtual ~AsyncLogBuffer();
+
+	bool Start(void);
+
+	bool Open(const std::string &fileName, const double &flushInterval);
+	void Close(const bool &waitForWriter = false);
+	bool IsOpen(void) const { return fd != -1; };
+
+	void RequestSync(void);
+
+	unsigned long GetDroppedByteCount(void) const { return droppedBytes; };
+
+protected:
+	virtual int_type overflow(int_type c);
+	virtual int sync(void);
+
+private:
+	static const unsigned int blockSize;// [bytes]
+	static const unsigned int blockCount;
+	static const unsigned int requestQueueSize;
+
+	std::ostream &outStream;
+
+	struct WriteRequest
+	{
+		char *block;// NULL if there is no data to write
+		unsigned int length;// [bytes]
+		int fd;
+		bool sync;// Call fdatasync after writing
+		bool close;// Close fd after writing
+		bool notify;// Post idleSemaphore when done
+	};
+
+	char *blockMemory;
+	char *current;// Being filled (NULL if none was free)
+	int fd;
+	double flushInterval;// [sec]
+	double lastHandOffTime;// [sec]
+	unsigned long droppedBytes;
+
+	// Requests move from the writing thread to the writer thread, and empty
+	// blocks are returned through freeBlocks
+	SPSCQueue<WriteRequest> requests;
+	SPSCQueue<char*> freeBlocks;
+
+	sem_t wakeSemaphore;
+	sem_t idleSemaphore;
+	pthread_t writerThread;
+	bool writerRunning;
+	volatile bool continueRunning;
+
+	friend void *LaunchLogWriterThread(void *pThisBuffer);
+	void WriterThreadEntry(void);
+	void ProcessRequest(const WriteRequest &request);
+
+	bool GetCurrentBlock(void);
+	bool HandOff(const bool &syncAfterWrite, const bool &closeAfterWrite,
+		const bool &notify);
+
+	// Not copyable
+	AsyncLogBuffer(const AsyncLogBuffer &);
+	AsyncLogBuffer& operator=(const AsyncLogBuffer &);
+};
+
+#endif// ASYNC_LOG_BUFFER_H_
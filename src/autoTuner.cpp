@@ -31,6 +31,11 @@
 //
 //==========================================================================
 double AutoTuner::switchTime(30.0);// [sec]
+const double AutoTuner::minimumTau(0.1);// [sec]
+const double AutoTuner::maximumTau(1000.0);// [sec]
+const double AutoTuner::tauTolerance(0.01);// [sec]
+const unsigned int AutoTuner::tauScanCount(30);
+const double AutoTuner::minimumReciprocalCondition(1.0e-10);// Same as Matrix::SolveLeastSquaresCholesky()
 
 //==========================================================================
 // Class:			AutoTuner
@@ -92,8 +97,8 @@ void AutoTuner::InitializeMembers(void)
 //					recommended controller values.
 //
 // Input Arguments:
-//		time					= const std::vector<double>& [sec]
-//		temperature				= const std::vector<double>& [deg F]
+//		time					= const DataSpan& [sec]
+//		temperature				= const DataSpan& [deg F]
 //      desiredBandwidth		= double, target closed-loop system bandwidth [rad/sec]
 //		desiredDamping			= double, target closed-loop system damping [-]
 //		maxRateScale			= double, fraction of max rate to use when
@@ -115,8 +120,8 @@ void AutoTuner::InitializeMembers(void)
 //		true for success, false otherwise
 //
 //==========================================================================
-bool AutoTuner::ProcessAutoTuneData(const std::vector<double> &time,
-	const std::vector<double> &temperature, double desiredBandwidth,
+bool AutoTuner::ProcessAutoTuneData(const DataSpan &time,
+	const DataSpan &temperature, double desiredBandwidth,
 		double desiredDamping, double maxRateScale, double referenceTemperature,
 		double feedForwardScale)
 {
@@ -138,6 +143,43 @@ bool AutoTuner::ProcessAutoTuneData(const std::vector<double> &time,
 	return MembersAreValid();
 }
 
+//==========================================================================
+// Class:			AutoTuner
+// Function:		AssembleRegression
+//
+// Description:		Assigns the constant and temperature columns of the
+//					regression matrix and the measured rate of temperature
+//					change.  The heater state column depends on tau, and is
+//					left for AssignHeatStateValue().
+//
+// Input Arguments:
+//		time		= const DataSpan& [sec]
+//		temperature	= const DataSpan& [deg F]
+//
+// Output Arguments:
+//		A			= Matrix&
+//		b			= Matrix&
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void AutoTuner::AssembleRegression(const DataSpan &time,
+	const DataSpan &temperature, Matrix &A, Matrix &b)
+{
+	assert(time.size() == temperature.size());
+	A.Resize(time.size() - 1, 3);
+	b.Resize(time.size() - 1, 1);
+	unsigned int i;
+	for (i = 0; i < b.GetNumberOfRows(); i++)
+	{
+		A(i,0) = 1.0;
+		A(i,1) = -temperature[i];
+		// Assign A(i,2) later
+		b(i,0) = (temperature[i + 1] - temperature[i]) / (time[i + 1] - time[i]);
+	}
+}
+
 //==========================================================================
 // Class:			AutoTuner
 // Function:		ComputeRegressionCoefficients
@@ -148,14 +190,14 @@ bool AutoTuner::ProcessAutoTuneData(const std::vector<double> &time,
 //					modeled rate of temperature change best matching the
 //					measured rate of temperature change.  Due to the inclusion
 //					of the lag on the heating element, there are actually two
-//					coupled differential equations.  We use a hill-climbing
-//					method to find the time constant for the lag, then use
+//					coupled differential equations.  We use a one-dimensional
+//					search to find the time constant for the lag, then use
 //					traditional least-squares regression for the remaining
 //					parameters.
 //
 // Input Arguments:
-//		time		= const std::vector<double>& [sec]
-//		temperature	= const std::vector<double>& [deg F]
+//		time		= const DataSpan& [sec]
+//		temperature	= const DataSpan& [deg F]
 //
 // Output Arguments:
 //		x			= Matrix&
@@ -164,28 +206,21 @@ bool AutoTuner::ProcessAutoTuneData(const std::vector<double> &time,
 //		true for success, false otherwise
 //
 //==========================================================================
-bool AutoTuner::ComputeRegressionCoefficients(const std::vector<double> &time,
-	const std::vector<double> &temperature, Matrix &x)
+bool AutoTuner::ComputeRegressionCoefficients(const DataSpan &time,
+	const DataSpan &temperature, Matrix &x)
 {
-	assert(time.size() == temperature.size());
-	Matrix A(time.size() - 1, 3), b(time.size() - 1, 1);
-	unsigned int i;
-	for (i = 0; i < b.GetNumberOfRows(); i++)
-	{
-		A(i,0) = 1.0;
-		A(i,1) = -temperature[i];
-		// Assign A(i,2) later
-		b(i,0) = (temperature[i + 1] - temperature[i]) / (time[i + 1] - time[i]);
-	}
+	Matrix A, b;
+	AssembleRegression(time, temperature, A, b);
 
-	if (!PerformHillClimbSearchForTau(time, A, b, tau))
+	if (!SearchForTau(time, A, b, tau))
 	{
 		outStream << "Failure while searching for tau" << std::endl;
 		return false;
 	}
 
+	// The SVD is only needed if the columns are not independent
 	AssignHeatStateValue(time, A, tau);
-	if (!A.LeftDivide(b, x))
+	if (!A.SolveLeastSquaresQR(b, x) && !A.LeftDivide(b, x))
 		return false;
 
 	c1 = x(1,0);
@@ -197,97 +232,335 @@ bool AutoTuner::ComputeRegressionCoefficients(const std::vector<double> &time,
 
 //==========================================================================
 // Class:			AutoTuner
-// Function:		PerformHillClimbSearchForTau
+// Function:		SearchForTau
 //
-// Description:		This method performs a hill-climbing in tau search to maximize
-//					the coefficient of determination.
+// Description:		Finds the value of tau that minimizes the sum of squared
+//					residuals of the regression (equivalently, maximizes the
+//					coefficient of determination).  The residual is not
+//					always unimodal in tau, so a coarse logarithmic scan first
+//					brackets the best minimum, then Brent's method refines it.
 //
 // Input Arguments:
-//		time	= const std::vector<double>& [sec]
-//		A		= Matrix
+//		time	= const DataSpan& [sec]
+//		A		= const Matrix&, with the first two columns assigned
 //		b		= const Matrix&
 //
 // Output Arguments:
-//		tau		= double [sec]
+//		tau		= double& [sec]
 //
 // Return Value:
 //		true for success, false otherwise
 //
 //==========================================================================
-bool AutoTuner::PerformHillClimbSearchForTau(const std::vector<double> &time,
-	Matrix A, const Matrix &b, double &tau) const
+bool AutoTuner::SearchForTau(const DataSpan &time, const Matrix &A,
+	const Matrix &b, double &tau) const
 {
-	const double tolerance(0.01);// [sec], stops the loop when best tau is known within this value
-	const double scaleFactor(1.01);
-	double minTauGuess(0.1), maxTauGuess(1000.0), tauGuess, rSq1, rSq2;
-	const unsigned int iterationLimit(1000);
-	unsigned int iteration;
-	Matrix x;
+	TauSearchData data;
+	BuildTauSearchData(time, A, b, data);
 
-	for (iteration = 0; iteration < iterationLimit; iteration++)
+	const double ratio(pow(maximumTau / minimumTau, 1.0 / (tauScanCount - 1)));
+	double tauGuess(minimumTau), sumSquares;
+	double bestSumSquares(0.0);
+	unsigned int i, bestIndex(tauScanCount);
+	for (i = 0; i < tauScanCount; i++, tauGuess *= ratio)
 	{
-		tauGuess = minTauGuess + 0.5 * (maxTauGuess - minTauGuess);
-		AssignHeatStateValue(time, A, tauGuess);
-		if (!A.LeftDivide(b, x))
-			return false;
-		rSq1 = ComputeCoefficientOfDetermination(b, A * x);
-
-		tauGuess *= scaleFactor;
-		AssignHeatStateValue(time, A, tauGuess);
-		if (!A.LeftDivide(b, x))
-			return false;
-		rSq2 = ComputeCoefficientOfDetermination(b, A * x);
-
-		if (rSq2 > rSq1)// Positive slope
-			minTauGuess = tauGuess / scaleFactor;
-		else
-			maxTauGuess = tauGuess / scaleFactor;
-
-		if (maxTauGuess - minTauGuess < tolerance)
-			break;
+		if (ComputeSumSquaredResiduals(data, tauGuess, sumSquares) &&
+			(bestIndex == tauScanCount || sumSquares < bestSumSquares))
+		{
+			bestIndex = i;
+			bestSumSquares = sumSquares;
+		}
 	}
 
-	tau = minTauGuess + 0.5 * (maxTauGuess - minTauGuess);
+	if (bestIndex == tauScanCount)
+		return false;
+
+	double lower(minimumTau), upper(maximumTau);
+	if (bestIndex > 0)
+		lower = minimumTau * pow(ratio, static_cast<double>(bestIndex - 1));
+	if (bestIndex < tauScanCount - 1)
+		upper = minimumTau * pow(ratio, static_cast<double>(bestIndex + 1));
+
+	tau = MinimizeSumSquaredResiduals(data, lower, upper);
 
 	return true;
 }
 
 //==========================================================================
 // Class:			AutoTuner
-// Function:		ComputeCoefficientOfDetermination
+// Function:		BuildTauSearchData
 //
-// Description:		Given two vectors of values, returns the coefficient of
-//					determination indicating the "goodness of fit" for the
-//					modeled data to the measured data.
+// Description:		Computes the parts of the regression that do not depend on
+//					tau.  Centering the columns removes the constant term from
+//					the problem (and improves conditioning) without changing
+//					the residuals.
 //
 // Input Arguments:
-//		measured	= const Matrix&
-//		modeled		= const Matrix&
+//		time	= const DataSpan& [sec]
+//		A		= const Matrix&, with the first two columns assigned
+//		b		= const Matrix&
 //
 // Output Arguments:
+//		data	= TauSearchData&
+//
+// Return Value:
 //		None
 //
+//==========================================================================
+void AutoTuner::BuildTauSearchData(const DataSpan &time, const Matrix &A,
+	const Matrix &b, TauSearchData &data) const
+{
+	const unsigned int count(b.GetNumberOfRows());
+	data.deltaTime.resize(count);
+	data.control.resize(count);
+	data.centeredTemperature.resize(count);
+	data.centeredRate.resize(count);
+
+	double meanTemperature(0.0), meanRate(0.0);
+	unsigned int i;
+	for (i = 0; i < count; i++)
+	{
+		data.deltaTime[i] = time[i + 1] - time[i];
+		data.control[i] = GetControlSignal(time[i]);
+		meanTemperature += A(i,1);
+		meanRate += b(i,0);
+	}
+	meanTemperature /= count;
+	meanRate /= count;
+
+	data.sumTT = 0.0;
+	data.sumTB = 0.0;
+	data.sumBB = 0.0;
+	for (i = 0; i < count; i++)
+	{
+		data.centeredTemperature[i] = A(i,1) - meanTemperature;
+		data.centeredRate[i] = b(i,0) - meanRate;
+		data.sumTT += data.centeredTemperature[i] * data.centeredTemperature[i];
+		data.sumTB += data.centeredTemperature[i] * data.centeredRate[i];
+		data.sumBB += data.centeredRate[i] * data.centeredRate[i];
+	}
+}
+
+//==========================================================================
+// Class:			AutoTuner
+// Function:		ComputeSumSquaredResiduals
+//
+// Description:		Computes the sum of squared residuals of the least-squares
+//					solution for the specified tau.  The heater state is
+//					computed as in AssignHeatStateValue(), and the (centered)
+//					two-parameter normal equations are solved directly.
+//
+// Input Arguments:
+//		data		= const TauSearchData&
+//		tau			= const double& [sec]
+//
+// Output Arguments:
+//		sumSquares	= double&
+//
 // Return Value:
-//		double
+//		bool, false if the residual could not be computed (e.g. the heater
+//		state integration is unstable for this tau, or the heater state is
+//		nearly collinear with the temperature)
 //
 //==========================================================================
-double AutoTuner::ComputeCoefficientOfDetermination(const Matrix &measured,
-	const Matrix &modeled) const
+bool AutoTuner::ComputeSumSquaredResiduals(const TauSearchData &data,
+	const double &tau, double &sumSquares) const
 {
-	double modeledAverage(0.0);
+	// The sums are accumulated in the same loop as the (serial) heater state
+	// integration; this is faster than computing them separately with the
+	// vector kernels, even where those are vectorized
+	double heatState(0.0);
+	double sumH(0.0), sumHH(0.0), sumTH(0.0), sumHB(0.0);
+	const unsigned int count(data.deltaTime.size());
+	const double inverseTau(1.0 / tau);
 	unsigned int i;
-	for (i = 0; i < modeled.GetNumberOfRows(); i++)
-		modeledAverage += modeled(i,0);
-	modeledAverage /= modeled.GetNumberOfRows();
+	for (i = 0; i < count; i++)
+	{
+		sumH += heatState;
+		sumHH += heatState * heatState;
+		sumTH += data.centeredTemperature[i] * heatState;
+		sumHB += heatState * data.centeredRate[i];
+		heatState += data.deltaTime[i] * (data.control[i] - heatState) * inverseTau;
+	}
+
+	// The other columns are centered, so only the heater column needs correcting
+	sumHH -= sumH * sumH / count;
+
+	// Relative to sumTT * sumHH, the determinant is one minus the squared
+	// correlation of the two columns; near-collinear columns leave only
+	// rounding error in the solution (and in the residual)
+	const double determinant(data.sumTT * sumHH - sumTH * sumTH);
+	if (!(determinant > minimumReciprocalCondition * data.sumTT * sumHH))// Also catches NaN
+		return false;
+
+	sumSquares = data.sumBB - (sumHH * data.sumTB * data.sumTB
+		- 2.0 * sumTH * data.sumTB * sumHB
+		+ data.sumTT * sumHB * sumHB) / determinant;
+
+	// Cancellation can make a near-perfect fit slightly negative
+	if (sumSquares < 0.0)
+		sumSquares = 0.0;
+
+	return true;
+}
+
+//==========================================================================
+// Class:			AutoTuner
+// Function:		GetSumSquaredResiduals
+//
+// Description:		Computes the sum of squared residuals of the regression for
+//					the specified tau, as evaluated during the tau search.
+//
+// Input Arguments:
+//		time		= const DataSpan& [sec]
+//		temperature	= const DataSpan& [deg F]
+//		tau			= const double& [sec]
+//
+// Output Arguments:
+//		sumSquares	= double&
+//
+// Return Value:
+//		bool, false if this tau would be rejected by the tau search
+//
+//==========================================================================
+bool AutoTuner::GetSumSquaredResiduals(const DataSpan &time,
+	const DataSpan &temperature, const double &tau, double &sumSquares) const
+{
+	if (time.size() < 2)
+		return false;
+
+	Matrix A, b;
+	AssembleRegression(time, temperature, A, b);
+
+	TauSearchData data;
+	BuildTauSearchData(time, A, b, data);
+
+	return ComputeSumSquaredResiduals(data, tau, sumSquares);
+}
 
-	double sumSqResiduals(0.0), sumSqTotal(0.0);
-	for (i = 0; i < modeled.GetNumberOfRows(); i++)
+//==========================================================================
+// Class:			AutoTuner
+// Function:		MinimizeSumSquaredResiduals
+//
+// Description:		Brent's method (golden-section search, accelerated with
+//					parabolic interpolation) for the tau that minimizes the sum
+//					of squared residuals within the specified bracket.
+//
+// Input Arguments:
+//		data	= const TauSearchData&
+//		lower	= double [sec]
+//		upper	= double [sec]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		double, tau [sec]
+//
+//==========================================================================
+double AutoTuner::MinimizeSumSquaredResiduals(const TauSearchData &data,
+	double lower, double upper) const
+{
+	const double goldenSection(0.5 * (3.0 - sqrt(5.0)));
+	const unsigned int iterationLimit(100);
+	const double halfTolerance(0.5 * tauTolerance);
+
+	// best has the lowest residual found so far, second the next lowest and
+	// third the previous value of second
+	double best(lower + goldenSection * (upper - lower));
+	double second(best), third(best);
+	// Failures are treated as infinitely poor fits
+	double fBest;
+	if (!ComputeSumSquaredResiduals(data, best, fBest))
+		fBest = HUGE_VAL;
+	double fSecond(fBest), fThird(fBest);
+	double step(0.0), previousStep(0.0);
+
+	unsigned int iteration;
+	for (iteration = 0; iteration < iterationLimit; iteration++)
 	{
-		sumSqResiduals += (measured(i,0) - modeled(i,0)) * (measured(i,0) - modeled(i,0));
-		sumSqTotal += (measured(i,0) - modeledAverage) * (measured(i,0) - modeledAverage);
+		const double middle(0.5 * (lower + upper));
+		if (fabs(best - middle) <= tauTolerance - 0.5 * (upper - lower))
+			break;
+
+		bool useGoldenSection(true);
+		if (fabs(previousStep) > halfTolerance)
+		{
+			// Try a parabola through the three best points
+			const double r((best - second) * (fBest - fThird));
+			double q((best - third) * (fBest - fSecond));
+			double p((best - third) * q - (best - second) * r);
+			q = 2.0 * (q - r);
+			if (q > 0.0)
+				p = -p;
+			q = fabs(q);
+
+			// Accept only if the step is shrinking and stays in the bracket
+			if (fabs(p) < fabs(0.5 * q * previousStep) &&
+				p > q * (lower - best) && p < q * (upper - best))
+			{
+				previousStep = step;
+				step = p / q;
+				const double next(best + step);
+				if (next - lower < tauTolerance || upper - next < tauTolerance)
+					step = middle > best ? halfTolerance : -halfTolerance;
+				useGoldenSection = false;
+			}
+		}
+
+		if (useGoldenSection)
+		{
+			previousStep = best >= middle ? lower - best : upper - best;
+			step = goldenSection * previousStep;
+		}
+
+		double next;
+		if (fabs(step) >= halfTolerance)
+			next = best + step;
+		else
+			next = best + (step > 0.0 ? halfTolerance : -halfTolerance);
+
+		double fNext;
+		if (!ComputeSumSquaredResiduals(data, next, fNext))
+			fNext = HUGE_VAL;
+
+		if (fNext <= fBest)
+		{
+			if (next >= best)
+				lower = best;
+			else
+				upper = best;
+
+			third = second;
+			fThird = fSecond;
+			second = best;
+			fSecond = fBest;
+			best = next;
+			fBest = fNext;
+		}
+		else
+		{
+			if (next < best)
+				lower = next;
+			else
+				upper = next;
+
+			if (fNext <= fSecond || second == best)
+			{
+				third = second;
+				fThird = fSecond;
+				second = next;
+				fSecond = fNext;
+			}
+			else if (fNext <= fThird || third == best || third == second)
+			{
+				third = next;
+				fThird = fNext;
+			}
+		}
 	}
 
-	return 1.0 - sumSqResiduals / sumSqTotal;
+	return best;
 }
 
 //==========================================================================
@@ -299,7 +572,7 @@ double AutoTuner::ComputeCoefficientOfDetermination(const Matrix &measured,
 //					variable as a function of tau.
 //
 // Input Arguments:
-//		time	= const std::vector<double>& [sec]
+//		time	= const DataSpan& [sec]
 //		A		= Matrix&
 //		tau		= double [sec]
 //
@@ -310,7 +583,7 @@ double AutoTuner::ComputeCoefficientOfDetermination(const Matrix &measured,
 //		None
 //
 //==========================================================================
-void AutoTuner::AssignHeatStateValue(const std::vector<double> &time, Matrix &A,
+void AutoTuner::AssignHeatStateValue(const DataSpan &time, Matrix &A,
 	double tau) const
 {
 	double heatState(0.0);
@@ -564,8 +837,8 @@ bool AutoTuner::ControllerParametersAreValid(void) const
 //
 //
 // Input Arguments:
-//		time		= const std::vector<double>& [sec]
-//		control		= const std::vector<double>& [%] (must be clamped to 0..1)
+//		time		= const DataSpan& [sec]
+//		control		= const DataSpan& [%] (must be clamped to 0..1)
 //
 // Output Arguments:
 //		temperature	= std::vector<double>&, response the specified control vector [deg F]
@@ -574,8 +847,8 @@ bool AutoTuner::ControllerParametersAreValid(void) const
 //		bool, true for success, false otherwise
 //
 //==========================================================================
-bool AutoTuner::GetSimulatedOpenLoopResponse(const std::vector<double> &time,
-	const std::vector<double> &control, std::vector<double> &temperature)
+bool AutoTuner::GetSimulatedOpenLoopResponse(const DataSpan &time,
+	const DataSpan &control, std::vector<double> &temperature)
 {
 	return GetSimulatedOpenLoopResponse(time, control, temperature,
 		ambientTemperature);
@@ -591,8 +864,8 @@ bool AutoTuner::GetSimulatedOpenLoopResponse(const std::vector<double> &time,
 //
 //
 // Input Arguments:
-//		time				= const std::vector<double>& [sec]
-//		control				= const std::vector<double>& [%] (must be clamped to 0..1)
+//		time				= const DataSpan& [sec]
+//		control				= const DataSpan& [%] (must be clamped to 0..1)
 //		initialTemperature	= double [deg F]
 //
 // Output Arguments:
@@ -602,8 +875,8 @@ bool AutoTuner::GetSimulatedOpenLoopResponse(const std::vector<double> &time,
 //		bool, true for success, false otherwise
 //
 //==========================================================================
-bool AutoTuner::GetSimulatedOpenLoopResponse(const std::vector<double> &time,
-	const std::vector<double> &control, std::vector<double> &temperature,
+bool AutoTuner::GetSimulatedOpenLoopResponse(const DataSpan &time,
+	const DataSpan &control, std::vector<double> &temperature,
 	double initialTemperature)
 {
 	return GetSimulatedOpenLoopResponse(time, control, temperature,
@@ -618,8 +891,8 @@ bool AutoTuner::GetSimulatedOpenLoopResponse(const std::vector<double> &time,
 //
 //
 // Input Arguments:
-//		time				= const std::vector<double>& [sec]
-//		control				= const std::vector<double>& [%] (must be clamped to 0..1)
+//		time				= const DataSpan& [sec]
+//		control				= const DataSpan& [%] (must be clamped to 0..1)
 //		initialTemperature	= double [deg F]
 //		ambientTemperature	= double [deg F]
 //		initialHeatOutput	= double [%]
@@ -631,8 +904,8 @@ bool AutoTuner::GetSimulatedOpenLoopResponse(const std::vector<double> &time,
 //		bool, true for success, false otherwise
 //
 //==========================================================================
-bool AutoTuner::GetSimulatedOpenLoopResponse(const std::vector<double> &time,
-	const std::vector<double> &control, std::vector<double> &temperature,
+bool AutoTuner::GetSimulatedOpenLoopResponse(const DataSpan &time,
+	const DataSpan &control, std::vector<double> &temperature,
 	double initialTemperature, double ambientTemperature, double initialHeatOutput)
 {
 	assert(time.size() == control.size());
@@ -643,6 +916,7 @@ bool AutoTuner::GetSimulatedOpenLoopResponse(const std::vector<double> &time,
 		
 	BuildSimulationMatrices(initialTemperature, ambientTemperature, initialHeatOutput);
 	temperature.clear();
+	temperature.reserve(time.size());
 
 	// Create the first data point
 	// We don't blindly push the initial temeprature, in case the time series we're
@@ -679,9 +953,7 @@ bool AutoTuner::GetSimulatedOpenLoopResponse(const std::vector<double> &time,
 //==========================================================================
 void AutoTuner::ComputeNextTimeStep(const double &control, const double &deltaTime)
 {
-	Matrix stateDot(state);
-	stateDot = system * state + input * control;
-	state += stateDot * deltaTime;
+	state += (system * state + input * control) * deltaTime;
 }
 
 //==========================================================================
@@ -728,10 +1000,21 @@ double AutoTuner::GetMinimumAutoTuneTime(double sampleRate)
 void AutoTuner::BuildSimulationMatrices(double initialTemperature,
 	double ambientTemperature, double initialHeatLevel)
 {
-	system = Matrix(3, 3, -c1, c1, c2, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0 / tau);
-	input = Matrix(3, 1, 0.0, 0.0, 1.0 / tau);
-	output = Matrix(1, 3, 1.0, 0.0, 0.0);
-	state = Matrix(3,1, initialTemperature, ambientTemperature, initialHeatLevel);
+	system.Zero();
+	system(0,0) = -c1;
+	system(0,1) = c1;
+	system(0,2) = c2;
+	system(2,2) = -1.0 / tau;
+
+	input.Zero();
+	input(2,0) = 1.0 / tau;
+
+	output.Zero();
+	output(0,0) = 1.0;
+
+	state(0,0) = initialTemperature;
+	state(1,0) = ambientTemperature;
+	state(2,0) = initialHeatLevel;
 	
 	/*outStream << "Built simulaiton matrices:\n";
 	outStream << "A =\n" << system << "\n\n";
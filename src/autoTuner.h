@@ -96,6 +96,8 @@
 
 // Local headers
 #include "matrix.h"
+#include "smallMatrix.h"
+#include "dataSpan.h"
 
 class AutoTuner
 {
@@ -105,8 +107,8 @@ public:
 	// Data passed to this method must be temperatures and time for a period where
 	// the heater is on at 100% capacity.  More data is better, but a reasonable
 	// minimum might be a period where the temperature increases about 10 deg F.
-	bool ProcessAutoTuneData(const std::vector<double> &time,
-		const std::vector<double> &temperature, double desiredBandwidth = 0.01,
+	bool ProcessAutoTuneData(const DataSpan &time,
+		const DataSpan &temperature, double desiredBandwidth = 0.01,
 		double desiredDamping = 5.0, double maxRateScale = 0.95,
 		double referenceTemperature = 180.0, double feedForwardScale = 0.8);
 		
@@ -123,18 +125,23 @@ public:
 
 	// Open-loop simulation
 	void DefineParameters(double c1, double c2, double tau);
-	bool GetSimulatedOpenLoopResponse(const std::vector<double> &time,
-		const std::vector<double> &control, std::vector<double> &temperature);
-	bool GetSimulatedOpenLoopResponse(const std::vector<double> &time,
-		const std::vector<double> &control, std::vector<double> &temperature,
+	bool GetSimulatedOpenLoopResponse(const DataSpan &time,
+		const DataSpan &control, std::vector<double> &temperature);
+	bool GetSimulatedOpenLoopResponse(const DataSpan &time,
+		const DataSpan &control, std::vector<double> &temperature,
 		double initialTemperature);
-	bool GetSimulatedOpenLoopResponse(const std::vector<double> &time,
-		const std::vector<double> &control, std::vector<double> &temperature,
+	bool GetSimulatedOpenLoopResponse(const DataSpan &time,
+		const DataSpan &control, std::vector<double> &temperature,
 		double initialTemperature, double ambientTemperature,
 		double initialHeatOutput = 0.0);
 
 	static double GetControlSignal(double time);// [%]
 
+	// Sum of squared residuals of the regression for a fixed tau; false if the
+	// heater state is unstable, or too nearly collinear with the temperature
+	bool GetSumSquaredResiduals(const DataSpan &time,
+		const DataSpan &temperature, const double &tau, double &sumSquares) const;
+
 private:
 	std::ostream &outStream;
 
@@ -154,15 +161,38 @@ private:
 	bool ControllerParametersAreValid(void) const;
 
 	// System identification methods
-	bool ComputeRegressionCoefficients(const std::vector<double> &time,
-		const std::vector<double> &temperature, Matrix &x);
+	static void AssembleRegression(const DataSpan &time,
+		const DataSpan &temperature, Matrix &A, Matrix &b);
+	bool ComputeRegressionCoefficients(const DataSpan &time,
+		const DataSpan &temperature, Matrix &x);
 	bool ComputeParametersFromCoefficients(const Matrix &x, const double &sampleTime);
 
-	bool PerformHillClimbSearchForTau(const std::vector<double> &time, Matrix A,
-		const Matrix &b, double &tau) const;
-	double ComputeCoefficientOfDetermination(const Matrix &measured,
-		const Matrix &modeled) const;
-	void AssignHeatStateValue(const std::vector<double> &time, Matrix &A,
+	// Only the heater state column of the regression depends on tau, so the
+	// sums involving the other columns are computed once for the tau search
+	struct TauSearchData
+	{
+		std::vector<double> deltaTime;// [sec]
+		std::vector<double> control;// [%]
+		std::vector<double> centeredTemperature;// [deg F], -T minus its mean
+		std::vector<double> centeredRate;// [deg F/sec], b minus its mean
+		double sumTT, sumTB, sumBB;
+	};
+
+	static const double minimumTau;// [sec]
+	static const double maximumTau;// [sec]
+	static const double tauTolerance;// [sec]
+	static const unsigned int tauScanCount;
+	static const double minimumReciprocalCondition;
+
+	bool SearchForTau(const DataSpan &time, const Matrix &A, const Matrix &b,
+		double &tau) const;
+	void BuildTauSearchData(const DataSpan &time, const Matrix &A,
+		const Matrix &b, TauSearchData &data) const;
+	bool ComputeSumSquaredResiduals(const TauSearchData &data,
+		const double &tau, double &sumSquares) const;
+	double MinimizeSumSquaredResiduals(const TauSearchData &data, double lower,
+		double upper) const;
+	void AssignHeatStateValue(const DataSpan &time, Matrix &A,
 		double tau) const;
 
 	// "Tuning" methods
@@ -170,8 +200,12 @@ private:
 	void ComputeRecommendedGains(double desiredBandwidth, double desiredDamping,
 		double feedForwardScale);
 	
-	// Simulation objects and methods
-	Matrix system, input, output, state;
+	// Simulation objects and methods (fixed size, so stepping the simulation
+	// does not allocate memory)
+	SmallMatrix<3,3> system;
+	SmallMatrix<3,1> input;
+	SmallMatrix<1,3> output;
+	SmallMatrix<3,1> state;
 	void BuildSimulationMatrices(double initialTemperature,
 		double ambientTemperature, double initialHeatLevel);
 	void ComputeNextTimeStep(const double &control, const double &deltaTime);
@@ -0,0 +1,103 @@
+// File:  binaryLogFormat.cpp
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Copy:  (c) Copyright 2026
+// Desc:  Definitions shared by the binary time history log writer and reader.
+
+// Local headers
+#include "binaryLogFormat.h"
+
+//==========================================================================
+// Class:			BinaryLogFormat
+// Function:		Constant definitions
+//
+// Description:		Constant definitions for BinaryLogFormat struct.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+const char BinaryLogFormat::magic[8] = { 'S', 'V', 'B', 'I', 'N', 'L', 'O', 'G' };
+const unsigned int BinaryLogFormat::version(1);
+const unsigned int BinaryLogFormat::timeSize(8);// [bytes]
+const unsigned int BinaryLogFormat::valueSize(4);// [bytes]
+unsigned int BinaryLogFormat::crcTable[256];
+bool BinaryLogFormat::crcTableInitialized(false);
+
+//==========================================================================
+// Class:			BinaryLogFormat
+// Function:		ComputeCRC
+//
+// Description:		Computes the CRC-32 of the specified data (table-driven,
+//					one byte at a time).
+//
+// Input Arguments:
+//		data	= const void*
+//		size	= const size_t& [bytes]
+//		crc		= const unsigned int&, result for the preceding data, or
+//				  zero to start a new checksum
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		unsigned int
+//
+//==========================================================================
+unsigned int BinaryLogFormat::ComputeCRC(const void *data, const size_t &size,
+	const unsigned int &crc)
+{
+	// Both the writer and the reader are used from a single thread, so this
+	// lazy initialization does not need to be protected
+	if (!crcTableInitialized)
+		InitializeCRCTable();
+
+	const unsigned char *bytes(static_cast<const unsigned char*>(data));
+	unsigned int c(~crc & 0xFFFFFFFF);
+	size_t i;
+	for (i = 0; i < size; i++)
+		c = crcTable[(c ^ bytes[i]) & 0xFF] ^ (c >> 8);
+
+	return ~c & 0xFFFFFFFF;
+}
+
+//==========================================================================
+// Class:			BinaryLogFormat
+// Function:		InitializeCRCTable
+//
+// Description:		Computes the CRC-32 lookup table.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void BinaryLogFormat::InitializeCRCTable(void)
+{
+	unsigned int i, j, c;
+	for (i = 0; i < 256; i++)
+	{
+		c = i;
+		for (j = 0; j < 8; j++)
+		{
+			if (c & 1)
+				c = 0xEDB88320 ^ (c >> 1);
+			else
+				c >>= 1;
+		}
+		crcTable[i] = c;
+	}
+
+	crcTableInitialized = true;
+}
@@ -0,0 +1,58 @@
+// File:  binaryLogFormat.h
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Copy:  (c) Copyright 2026
+// Desc:  Definitions shared by the binary time history log writer and reader.
+//        All values are stored in little-endian byte order (the native order
+//        on the Raspberry Pi and on x86).  A file contains:
+//
+//        Header:
+//          char[8]   magic ("SVBINLOG")
+//          uint32    version
+//          uint32    column count (including time, which is always column 0)
+//          uint32    maximum number of records per block
+//          for each column:
+//            uint16 + chars   name
+//            uint16 + chars   units
+//          uint32    CRC-32 of everything above
+//
+//        Blocks (repeated until end of file):
+//          uint32    record count (1 to the maximum)
+//          float64[] time for each record [sec]
+//          float32[] values of column 1 for each record
+//          ...
+//          float32[] values of the last column for each record
+//          uint32    CRC-32 of the record count and data
+//
+//        Every record has the same width; storing each block column by column
+//        lets the reader copy values straight into its per-column arrays.
+
+#ifndef BINARY_LOG_FORMAT_H_
+#define BINARY_LOG_FORMAT_H_
+
+// Standard C++ headers
+#include <cstddef>
+
+struct BinaryLogFormat
+{
+	static const char magic[8];
+	static const unsigned int version;
+
+	static const unsigned int timeSize;// [bytes]
+	static const unsigned int valueSize;// [bytes]
+
+	static unsigned int GetRecordSize(const unsigned int &columnCount)// [bytes]
+	{ return timeSize + (columnCount - 1) * valueSize; };
+
+	// CRC-32 (IEEE 802.3 polynomial, as used by zlib) - pass the result of the
+	// previous call as crc to checksum data in pieces
+	static unsigned int ComputeCRC(const void *data, const size_t &size,
+		const unsigned int &crc = 0);
+
+private:
+	static unsigned int crcTable[256];
+	static bool crcTableInitialized;
+	static void InitializeCRCTable(void);
+};
+
+#endif// BINARY_LOG_FORMAT_H_
@@ -0,0 +1,327 @@
+// File:  binaryLogReader.cpp
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Copy:  (c) Copyright 2026
+// Desc:  Reads time histories written by BinaryLogWriter (see
+//        binaryLogFormat.h).  The whole file is loaded with a single read and
+//        each column is returned as a contiguous array.  Reading stops at the
+//        first block that is truncated (e.g. the application stopped while
+//        writing) or fails its checksum; the records before it are kept.
+
+// Standard C++ headers
+#include <fstream>
+#include <cstring>
+
+// Local headers
+#include "binaryLogReader.h"
+#include "binaryLogFormat.h"
+
+//==========================================================================
+// Class:			BinaryLogReader
+// Function:		BinaryLogReader
+//
+// Description:		Constructor for BinaryLogReader class.
+//
+// Input Arguments:
+//		outStream	= std::ostream&, for error messages
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+BinaryLogReader::BinaryLogReader(std::ostream &outStream) : outStream(outStream)
+{
+	damaged = false;
+}
+
+//==========================================================================
+// Class:			BinaryLogReader
+// Function:		GetRecordCount
+//
+// Description:		Returns the number of records that were read.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		unsigned int
+//
+//==========================================================================
+unsigned int BinaryLogReader::GetRecordCount(void) const
+{
+	if (columns.empty())
+		return 0;
+	return columns.front().size();
+}
+
+//==========================================================================
+// Class:			BinaryLogReader
+// Function:		Read
+//
+// Description:		Reads the specified file, replacing any previously read
+//					data.
+//
+// Input Arguments:
+//		fileName	= const std::string&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if the header was valid (check IsDamaged() to find out
+//		if all of the records were read), false otherwise
+//
+//==========================================================================
+bool BinaryLogReader::Read(const std::string &fileName)
+{
+	names.clear();
+	units.clear();
+	columns.clear();
+	damaged = false;
+
+	if (!ReadFile(fileName))
+		return false;
+
+	size_t position(0);
+	unsigned int maxRecordsPerBlock;
+	if (!ParseHeader(position, maxRecordsPerBlock))
+	{
+		outStream << "'" << fileName << "' is not a valid binary log" << std::endl;
+		return false;
+	}
+
+	// Every record has the same size, so the file size tells us how many to expect
+	const size_t expectedRecords((contents.size() - position)
+		/ BinaryLogFormat::GetRecordSize(names.size()));
+	columns.resize(names.size());
+	unsigned int i;
+	for (i = 0; i < columns.size(); i++)
+		columns[i].reserve(expectedRecords);
+
+	while (position < contents.size())
+	{
+		if (!ParseBlock(position, maxRecordsPerBlock))
+		{
+			outStream << "Warning:  '" << fileName << "' is damaged; only the first "
+				<< GetRecordCount() << " records could be read" << std::endl;
+			damaged = true;
+			break;
+		}
+	}
+
+	// Release the file contents (keeps memory use down for large logs)
+	std::vector<char>().swap(contents);
+
+	return true;
+}
+
+//==========================================================================
+// Class:			BinaryLogReader
+// Function:		ReadFile
+//
+// Description:		Loads the entire file into memory.
+//
+// Input Arguments:
+//		fileName	= const std::string&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool BinaryLogReader::ReadFile(const std::string &fileName)
+{
+	std::ifstream file(fileName.c_str(), std::ios::in | std::ios::binary);
+	if (!file.is_open() || !file.good())
+	{
+		outStream << "Failed to open '" << fileName << "' for input" << std::endl;
+		return false;
+	}
+
+	file.seekg(0, std::ios::end);
+	const std::streamoff size(file.tellg());
+	file.seekg(0, std::ios::beg);
+	if (size <= 0)
+	{
+		outStream << "'" << fileName << "' is empty" << std::endl;
+		return false;
+	}
+
+	contents.resize(static_cast<size_t>(size));
+	if (!file.read(&contents.front(), size))
+	{
+		outStream << "Failed to read '" << fileName << "'" << std::endl;
+		return false;
+	}
+
+	return true;
+}
+
+//==========================================================================
+// Class:			BinaryLogReader
+// Function:		ParseHeader
+//
+// Description:		Reads and checks the file header.
+//
+// Input Arguments:
+//		position			= size_t&, offset of the header
+//
+// Output Arguments:
+//		position			= size_t&, offset of the first block
+//		maxRecordsPerBlock	= unsigned int&
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool BinaryLogReader::ParseHeader(size_t &position,
+	unsigned int &maxRecordsPerBlock)
+{
+	char magic[sizeof(BinaryLogFormat::magic)];
+	unsigned int version, columnCount;
+	if (!Extract(position, magic, sizeof(magic)) ||
+		memcmp(magic, BinaryLogFormat::magic, sizeof(magic)) != 0 ||
+		!Extract(position, &version, sizeof(version)) ||
+		version != BinaryLogFormat::version ||
+		!Extract(position, &columnCount, sizeof(columnCount)) ||
+		columnCount == 0 ||
+		!Extract(position, &maxRecordsPerBlock, sizeof(maxRecordsPerBlock)) ||
+		maxRecordsPerBlock == 0)
+		return false;
+
+	names.resize(columnCount);
+	units.resize(columnCount);
+	unsigned int i;
+	for (i = 0; i < columnCount; i++)
+	{
+		if (!ExtractString(position, names[i]) || !ExtractString(position, units[i]))
+			return false;
+	}
+
+	const unsigned int expectedCRC(BinaryLogFormat::ComputeCRC(&contents.front(), position));
+	unsigned int crc;
+	return Extract(position, &crc, sizeof(crc)) && crc == expectedCRC;
+}
+
+//==========================================================================
+// Class:			BinaryLogReader
+// Function:		ParseBlock
+//
+// Description:		Checks one block and appends its records to the columns.
+//
+// Input Arguments:
+//		position			= size_t&, offset of the block
+//		maxRecordsPerBlock	= const unsigned int&
+//
+// Output Arguments:
+//		position			= size_t&, offset of the next block
+//
+// Return Value:
+//		bool, true for success, false if the block is incomplete or damaged
+//
+//==========================================================================
+bool BinaryLogReader::ParseBlock(size_t &position,
+	const unsigned int &maxRecordsPerBlock)
+{
+	const size_t start(position);
+	unsigned int recordCount;
+	if (!Extract(position, &recordCount, sizeof(recordCount)) ||
+		recordCount == 0 || recordCount > maxRecordsPerBlock)
+		return false;
+
+	const size_t dataSize(recordCount * BinaryLogFormat::GetRecordSize(columns.size()));
+	unsigned int crc;
+	if (contents.size() - position < dataSize + sizeof(crc))
+		return false;
+
+	memcpy(&crc, &contents[position + dataSize], sizeof(crc));
+	if (crc != BinaryLogFormat::ComputeCRC(&contents[start], position - start + dataSize))
+		return false;
+
+	std::vector<double> &time(columns.front());
+	const size_t oldCount(time.size());
+	time.resize(oldCount + recordCount);
+	memcpy(&time[oldCount], &contents[position], recordCount * BinaryLogFormat::timeSize);
+	position += recordCount * BinaryLogFormat::timeSize;
+
+	float value;
+	unsigned int i, j;
+	for (i = 1; i < columns.size(); i++)
+	{
+		for (j = 0; j < recordCount; j++)
+		{
+			memcpy(&value, &contents[position], sizeof(value));
+			columns[i].push_back(value);
+			position += sizeof(value);
+		}
+	}
+
+	position += sizeof(crc);
+	return true;
+}
+
+//==========================================================================
+// Class:			BinaryLogReader
+// Function:		Extract
+//
+// Description:		Copies raw bytes out of the file contents.
+//
+// Input Arguments:
+//		position	= size_t&, offset of the data
+//		size		= const size_t& [bytes]
+//
+// Output Arguments:
+//		position	= size_t&, offset following the data
+//		data		= void*
+//
+// Return Value:
+//		bool, true for success, false if the file is too short
+//
+//==========================================================================
+bool BinaryLogReader::Extract(size_t &position, void *data,
+	const size_t &size) const
+{
+	if (contents.size() - position < size)
+		return false;
+
+	memcpy(data, &contents[position], size);
+	position += size;
+	return true;
+}
+
+//==========================================================================
+// Class:			BinaryLogReader
+// Function:		ExtractString
+//
+// Description:		Copies a length-prefixed string out of the file contents.
+//
+// Input Arguments:
+//		position	= size_t&, offset of the string
+//
+// Output Arguments:
+//		position	= size_t&, offset following the string
+//		s			= std::string&
+//
+// Return Value:
+//		bool, true for success, false if the file is too short
+//
+//==========================================================================
+bool BinaryLogReader::ExtractString(size_t &position, std::string &s) const
+{
+	unsigned short length;
+	if (!Extract(position, &length, sizeof(length)) ||
+		contents.size() - position < length)
+		return false;
+
+	s.assign(&contents[position], length);
+	position += length;
+	return true;
+}
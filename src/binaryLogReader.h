@@ -0,0 +1,55 @@
+// File:  binaryLogReader.h
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Copy:  (c) Copyright 2026
+// Desc:  Reads time histories written by BinaryLogWriter (see
+//        binaryLogFormat.h).  The whole file is loaded with a single read and
+//        each column is returned as a contiguous array.  Reading stops at the
+//        first block that is truncated (e.g. the application stopped while
+//        writing) or fails its checksum; the records before it are kept.
+
+#ifndef BINARY_LOG_READER_H_
+#define BINARY_LOG_READER_H_
+
+// Standard C++ headers
+#include <string>
+#include <vector>
+#include <iostream>
+
+class BinaryLogReader
+{
+public:
+	explicit BinaryLogReader(std::ostream &outStream = std::cout);
+
+	bool Read(const std::string &fileName);
+
+	// Column 0 is time [sec]
+	unsigned int GetColumnCount(void) const { return names.size(); };
+	unsigned int GetRecordCount(void) const;
+	const std::string& GetColumnName(const unsigned int &i) const { return names[i]; };
+	const std::string& GetColumnUnits(const unsigned int &i) const { return units[i]; };
+	const std::vector<double>& GetColumn(const unsigned int &i) const { return columns[i]; };
+
+	// True if the file ended part way through a block or a block failed its
+	// checksum (records up to that block are still available)
+	bool IsDamaged(void) const { return damaged; };
+
+private:
+	std::ostream &outStream;
+
+	std::vector<std::string> names;
+	std::vector<std::string> units;
+	std::vector<std::vector<double> > columns;
+	bool damaged;
+
+	std::vector<char> contents;
+
+	bool ReadFile(const std::string &fileName);
+	bool ParseHeader(size_t &position, unsigned int &maxRecordsPerBlock);
+	bool ParseBlock(size_t &position, const unsigned int &maxRecordsPerBlock);
+
+	bool Extract(size_t &position, void *data, const size_t &size) const;
+	bool ExtractString(size_t &position, std::string &s) const;
+};
+
+#endif// BINARY_LOG_READER_H_
@@ -0,0 +1,299 @@
+// File:  binaryLogWriter.cpp
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Copy:  (c) Copyright 2026
+// Desc:  Writes time histories in the compact binary log format (see
+//        binaryLogFormat.h).  Records are collected in memory and written to
+//        the stream one checksummed block at a time.  Time is always the
+//        first column; other columns are added with AddColumn() before the
+//        first record.
+
+// Standard C++ headers
+#include <cassert>
+
+// Local headers
+#include "binaryLogWriter.h"
+#include "binaryLogFormat.h"
+
+//==========================================================================
+// Class:			BinaryLogWriter
+// Function:		BinaryLogWriter
+//
+// Description:		Constructor for BinaryLogWriter class.
+//
+// Input Arguments:
+//		file				= std::ostream&, opened in binary mode
+//		maxRecordsPerBlock	= const unsigned int&, records held in memory
+//							  before they are written to file
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+BinaryLogWriter::BinaryLogWriter(std::ostream &file,
+	const unsigned int &maxRecordsPerBlock) : file(file),
+	maxRecordsPerBlock(maxRecordsPerBlock)
+{
+	assert(maxRecordsPerBlock > 0);
+
+	headerWritten = false;
+	recordCount = 0;
+	totalRecordCount = 0;
+
+	AddColumn("Time", "sec");
+	times.resize(maxRecordsPerBlock);
+}
+
+//==========================================================================
+// Class:			BinaryLogWriter
+// Function:		~BinaryLogWriter
+//
+// Description:		Destructor for BinaryLogWriter class.  Writes any records
+//					that remain in memory.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+BinaryLogWriter::~BinaryLogWriter()
+{
+	Flush();
+}
+
+//==========================================================================
+// Class:			BinaryLogWriter
+// Function:		AddColumn
+//
+// Description:		Adds a column to the log.  Must be called before the first
+//					record is added.
+//
+// Input Arguments:
+//		name	= const std::string&
+//		units	= const std::string&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void BinaryLogWriter::AddColumn(const std::string &name,
+	const std::string &units)
+{
+	assert(!headerWritten);
+
+	names.push_back(name);
+	this->units.push_back(units);
+}
+
+//==========================================================================
+// Class:			BinaryLogWriter
+// Function:		AddRecord
+//
+// Description:		Adds a record.  It is written to file when the current
+//					block is full (or on Flush()).
+//
+// Input Arguments:
+//		time	= const double& [sec]
+//		values	= const double*, one for each column added with AddColumn()
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool BinaryLogWriter::AddRecord(const double &time, const double *values)
+{
+	if (!headerWritten && !WriteHeader())
+		return false;
+
+	times[recordCount] = time;
+	unsigned int i;
+	for (i = 1; i < names.size(); i++)
+		this->values[(i - 1) * maxRecordsPerBlock + recordCount]
+			= static_cast<float>(values[i - 1]);
+
+	totalRecordCount++;
+	if (++recordCount == maxRecordsPerBlock)
+		return WriteBlock();
+
+	return true;
+}
+
+//==========================================================================
+// Class:			BinaryLogWriter
+// Function:		Flush
+//
+// Description:		Writes all records held in memory to the stream (as a
+//					short block, if necessary) and flushes the stream.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool BinaryLogWriter::Flush(void)
+{
+	if (!headerWritten && !WriteHeader())
+		return false;
+
+	if (recordCount > 0 && !WriteBlock())
+		return false;
+
+	file.flush();
+	return file.good();
+}
+
+//==========================================================================
+// Class:			BinaryLogWriter
+// Function:		WriteHeader
+//
+// Description:		Writes the file header and allocates the block storage.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool BinaryLogWriter::WriteHeader(void)
+{
+	const unsigned int columnCount(names.size());
+	values.resize((columnCount - 1) * maxRecordsPerBlock);
+	buffer.reserve(2 * sizeof(unsigned int)
+		+ maxRecordsPerBlock * BinaryLogFormat::GetRecordSize(columnCount));
+
+	buffer.clear();
+	Append(buffer, BinaryLogFormat::magic, sizeof(BinaryLogFormat::magic));
+	Append(buffer, &BinaryLogFormat::version, sizeof(unsigned int));
+	Append(buffer, &columnCount, sizeof(unsigned int));
+	Append(buffer, &maxRecordsPerBlock, sizeof(unsigned int));
+
+	unsigned int i;
+	for (i = 0; i < columnCount; i++)
+	{
+		AppendString(buffer, names[i]);
+		AppendString(buffer, units[i]);
+	}
+
+	const unsigned int crc(BinaryLogFormat::ComputeCRC(&buffer.front(), buffer.size()));
+	Append(buffer, &crc, sizeof(crc));
+
+	headerWritten = true;
+	file.write(&buffer.front(), buffer.size());
+	return file.good();
+}
+
+//==========================================================================
+// Class:			BinaryLogWriter
+// Function:		WriteBlock
+//
+// Description:		Writes the records held in memory as one block and
+//					flushes the stream, so completed blocks are not held in
+//					the stream's buffer.  For AsyncLogBuffer streams, this
+//					only hands data to the writer thread once the flush
+//					interval has elapsed.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool BinaryLogWriter::WriteBlock(void)
+{
+	assert(recordCount > 0);
+
+	buffer.clear();
+	Append(buffer, &recordCount, sizeof(recordCount));
+	Append(buffer, &times.front(), recordCount * BinaryLogFormat::timeSize);
+
+	unsigned int i;
+	for (i = 1; i < names.size(); i++)
+		Append(buffer, &values[(i - 1) * maxRecordsPerBlock],
+			recordCount * BinaryLogFormat::valueSize);
+
+	const unsigned int crc(BinaryLogFormat::ComputeCRC(&buffer.front(), buffer.size()));
+	Append(buffer, &crc, sizeof(crc));
+
+	recordCount = 0;
+	file.write(&buffer.front(), buffer.size());
+	file.flush();
+	return file.good();
+}
+
+//==========================================================================
+// Class:			BinaryLogWriter
+// Function:		Append
+//
+// Description:		Appends raw bytes to the buffer.
+//
+// Input Arguments:
+//		data	= const void*
+//		size	= const size_t& [bytes]
+//
+// Output Arguments:
+//		buffer	= std::vector<char>&
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void BinaryLogWriter::Append(std::vector<char> &buffer, const void *data,
+	const size_t &size)
+{
+	const char *bytes(static_cast<const char*>(data));
+	buffer.insert(buffer.end(), bytes, bytes + size);
+}
+
+//==========================================================================
+// Class:			BinaryLogWriter
+// Function:		AppendString
+//
+// Description:		Appends a length-prefixed string to the buffer.
+//
+// Input Arguments:
+//		s	= const std::string&, truncated to 65535 characters
+//
+// Output Arguments:
+//		buffer	= std::vector<char>&
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void BinaryLogWriter::AppendString(std::vector<char> &buffer,
+	const std::string &s)
+{
+	unsigned short length(0xFFFF);
+	if (s.length() < length)
+		length = static_cast<unsigned short>(s.length());
+
+	Append(buffer, &length, sizeof(length));
+	Append(buffer, s.c_str(), length);
+}
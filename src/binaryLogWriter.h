@@ -0,0 +1,62 @@
+// File:  binaryLogWriter.h
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Copy:  (c) Copyright 2026
+// Desc:  Writes time histories in the compact binary log format (see
+//        binaryLogFormat.h).  Records are collected in memory and written to
+//        the stream one checksummed block at a time.  Time is always the
+//        first column; other columns are added with AddColumn() before the
+//        first record.
+
+#ifndef BINARY_LOG_WRITER_H_
+#define BINARY_LOG_WRITER_H_
+
+// Standard C++ headers
+#include <string>
+#include <vector>
+#include <iostream>
+
+class BinaryLogWriter
+{
+public:
+	explicit BinaryLogWriter(std::ostream &file,
+		const unsigned int &maxRecordsPerBlock = 128);
+	~BinaryLogWriter();
+
+	void AddColumn(const std::string &name, const std::string &units);
+
+	// values must contain one element for each column added with AddColumn()
+	bool AddRecord(const double &time, const double *values);
+	bool Flush(void);
+
+	unsigned long GetRecordCount(void) const { return totalRecordCount; };
+
+private:
+	std::ostream &file;
+	const unsigned int maxRecordsPerBlock;
+
+	std::vector<std::string> names;
+	std::vector<std::string> units;
+	bool headerWritten;
+
+	// Current block, stored column by column
+	std::vector<double> times;
+	std::vector<float> values;// Column i starts at (i - 1) * maxRecordsPerBlock
+	unsigned int recordCount;
+	unsigned long totalRecordCount;
+
+	std::vector<char> buffer;
+
+	bool WriteHeader(void);
+	bool WriteBlock(void);
+
+	static void Append(std::vector<char> &buffer, const void *data,
+		const size_t &size);
+	static void AppendString(std::vector<char> &buffer, const std::string &s);
+
+	// Not copyable
+	BinaryLogWriter(const BinaryLogWriter &);
+	BinaryLogWriter& operator=(const BinaryLogWriter &);
+};
+
+#endif// BINARY_LOG_WRITER_H_
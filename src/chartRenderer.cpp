@@ -0,0 +1,474 @@
+// File:  chartRenderer.cpp
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Copy:  (c) Copyright 2026
+// Desc:  In-process line chart renderer (axes, grid, title, labels, legend).
+//        Writes SVG directly to file, so no plotting process is required.
+//        Output is streamed through a fixed-size buffer and the image is
+//        replaced atomically, so readers never see a partially written file.
+
+// Standard C++ headers
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <cerrno>
+
+// Local headers
+#include "chartRenderer.h"
+
+//==========================================================================
+// Class:			ChartRenderer
+// Function:		Constant definitions
+//
+// Description:		Constant definitions for ChartRenderer class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+const unsigned int ChartRenderer::marginLeft = 70;
+const unsigned int ChartRenderer::marginRight = 20;
+const unsigned int ChartRenderer::marginTop = 40;
+const unsigned int ChartRenderer::marginBottom = 50;
+const unsigned int ChartRenderer::targetTickCount = 8;
+const unsigned int ChartRenderer::bufferSize = 16 * 1024;
+
+//==========================================================================
+// Class:			ChartRenderer
+// Function:		ChartRenderer
+//
+// Description:		Constructor for ChartRenderer class.
+//
+// Input Arguments:
+//		outStream	= std::ostream&
+//		width		= unsigned int [px]
+//		height		= unsigned int [px]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+ChartRenderer::ChartRenderer(std::ostream &outStream, unsigned int width,
+	unsigned int height) : outStream(outStream), width(width), height(height)
+{
+	assert(width > marginLeft + marginRight);
+	assert(height > marginTop + marginBottom);
+
+	SetXRange(0.0, 1.0);
+	SetYRange(0.0, 1.0);
+}
+
+//==========================================================================
+// Class:			ChartRenderer
+// Function:		SetXRange
+//
+// Description:		Sets the limits of the x-axis.  If the limits are equal,
+//					they are spread apart so the axis has a non-zero length.
+//
+// Input Arguments:
+//		min	= const double&
+//		max	= const double&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void ChartRenderer::SetXRange(const double &min, const double &max)
+{
+	assert(min <= max);
+
+	xMin = min;
+	xMax = max;
+	if (xMax - xMin <= 0.0)
+	{
+		xMin -= 0.5;
+		xMax += 0.5;
+	}
+}
+
+//==========================================================================
+// Class:			ChartRenderer
+// Function:		SetYRange
+//
+// Description:		Sets the limits of the y-axis.  If the limits are equal,
+//					they are spread apart so the axis has a non-zero length.
+//
+// Input Arguments:
+//		min	= const double&
+//		max	= const double&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void ChartRenderer::SetYRange(const double &min, const double &max)
+{
+	assert(min <= max);
+
+	yMin = min;
+	yMax = max;
+	if (yMax - yMin <= 0.0)
+	{
+		yMin -= 0.5;
+		yMax += 0.5;
+	}
+}
+
+//==========================================================================
+// Class:			ChartRenderer
+// Function:		AddSeries
+//
+// Description:		Adds a data series to be drawn as a line.  The data is not
+//					copied.
+//
+// Input Arguments:
+//		x		= const std::vector<double>&
+//		y		= const std::vector<double>&
+//		title	= const std::string&, shown in the legend
+//		color	= const std::string&, any SVG color (e.g. "red", "#ff0000")
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void ChartRenderer::AddSeries(const std::vector<double> &x,
+	const std::vector<double> &y, const std::string &title,
+	const std::string &color)
+{
+	assert(x.size() == y.size());
+
+	Series s;
+	s.x = &x;
+	s.y = &y;
+	s.title = title;
+	s.color = color;
+	series.push_back(s);
+}
+
+//==========================================================================
+// Class:			ChartRenderer
+// Function:		Render
+//
+// Description:		Writes the chart to the specified file.  The image is
+//					first written to a temporary file, then renamed.
+//
+// Input Arguments:
+//		fileName	= const std::string&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool ChartRenderer::Render(const std::string &fileName)
+{
+	const std::string tempFileName(fileName + ".tmp");
+	FILE *file = fopen(tempFileName.c_str(), "w");
+	if (!file)
+	{
+		outStream << "Failed to open '" << tempFileName << "' for output:  " << strerror(errno) << std::endl;
+		return false;
+	}
+	setvbuf(file, NULL, _IOFBF, bufferSize);
+
+	fprintf(file, "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+		"<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"%u\" height=\"%u\" "
+		"viewBox=\"0 0 %u %u\" font-family=\"sans-serif\" font-size=\"12\">\n",
+		width, height, width, height);
+	fprintf(file, "<rect width=\"100%%\" height=\"100%%\" fill=\"white\"/>\n");
+	fprintf(file, "<clipPath id=\"plotArea\"><rect x=\"%u\" y=\"%u\" width=\"%u\" height=\"%u\"/></clipPath>\n",
+		marginLeft, marginTop, width - marginLeft - marginRight, height - marginTop - marginBottom);
+
+	WriteAxes(file);
+
+	unsigned int i;
+	for (i = 0; i < series.size(); i++)
+		WriteSeries(file, series[i]);
+
+	WriteLegend(file);
+
+	fprintf(file, "</svg>\n");
+
+	const bool writeOK(ferror(file) == 0);
+	if (fclose(file) != 0 || !writeOK)
+	{
+		outStream << "Failed to write '" << tempFileName << "'" << std::endl;
+		remove(tempFileName.c_str());
+		return false;
+	}
+
+	if (rename(tempFileName.c_str(), fileName.c_str()) != 0)
+	{
+		outStream << "Failed to move '" << tempFileName << "' to '" << fileName << "':  " << strerror(errno) << std::endl;
+		remove(tempFileName.c_str());
+		return false;
+	}
+
+	return true;
+}
+
+//==========================================================================
+// Class:			ChartRenderer
+// Function:		GetPlotX
+//
+// Description:		Converts an x-value to a horizontal image coordinate.
+//
+// Input Arguments:
+//		x	= const double&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		double [px]
+//
+//==========================================================================
+double ChartRenderer::GetPlotX(const double &x) const
+{
+	return marginLeft + (x - xMin) / (xMax - xMin) * (width - marginLeft - marginRight);
+}
+
+//==========================================================================
+// Class:			ChartRenderer
+// Function:		GetPlotY
+//
+// Description:		Converts a y-value to a vertical image coordinate.
+//
+// Input Arguments:
+//		y	= const double&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		double [px]
+//
+//==========================================================================
+double ChartRenderer::GetPlotY(const double &y) const
+{
+	return height - marginBottom - (y - yMin) / (yMax - yMin) * (height - marginTop - marginBottom);
+}
+
+//==========================================================================
+// Class:			ChartRenderer
+// Function:		GetTickSpacing
+//
+// Description:		Chooses a "nice" spacing (1, 2 or 5 times a power of ten)
+//					that gives approximately targetTickCount ticks.
+//
+// Input Arguments:
+//		range	= const double&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		double
+//
+//==========================================================================
+double ChartRenderer::GetTickSpacing(const double &range)
+{
+	assert(range > 0.0);
+
+	const double rawSpacing(range / targetTickCount);
+	const double magnitude(pow(10.0, floor(log10(rawSpacing))));
+	const double normalized(rawSpacing / magnitude);
+
+	if (normalized < 1.5)
+		return magnitude;
+	else if (normalized < 3.0)
+		return 2.0 * magnitude;
+	else if (normalized < 7.0)
+		return 5.0 * magnitude;
+	return 10.0 * magnitude;
+}
+
+//==========================================================================
+// Class:			ChartRenderer
+// Function:		EscapeText
+//
+// Description:		Replaces characters that have special meaning in XML.
+//
+// Input Arguments:
+//		text	= const std::string&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		std::string
+//
+//==========================================================================
+std::string ChartRenderer::EscapeText(const std::string &text)
+{
+	std::string escaped;
+	unsigned int i;
+	for (i = 0; i < text.length(); i++)
+	{
+		if (text[i] == '&')
+			escaped.append("&amp;");
+		else if (text[i] == '<')
+			escaped.append("&lt;");
+		else if (text[i] == '>')
+			escaped.append("&gt;");
+		else if (text[i] == '"')
+			escaped.append("&quot;");
+		else
+			escaped.push_back(text[i]);
+	}
+
+	return escaped;
+}
+
+//==========================================================================
+// Class:			ChartRenderer
+// Function:		WriteAxes
+//
+// Description:		Writes the grid, tick labels, plot border, title and axis
+//					labels.
+//
+// Input Arguments:
+//		file	= FILE*
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void ChartRenderer::WriteAxes(FILE *file) const
+{
+	const unsigned int left(marginLeft), right(width - marginRight);
+	const unsigned int top(marginTop), bottom(height - marginBottom);
+
+	fprintf(file, "<g stroke=\"#d0d0d0\" stroke-width=\"1\">\n");
+
+	const double xSpacing(GetTickSpacing(xMax - xMin));
+	const double ySpacing(GetTickSpacing(yMax - yMin));
+	const long xFirst(static_cast<long>(ceil(xMin / xSpacing)));
+	const long xLast(static_cast<long>(floor(xMax / xSpacing)));
+	const long yFirst(static_cast<long>(ceil(yMin / ySpacing)));
+	const long yLast(static_cast<long>(floor(yMax / ySpacing)));
+
+	long i;
+	double p;
+	for (i = xFirst; i <= xLast; i++)
+	{
+		p = GetPlotX(i * xSpacing);
+		fprintf(file, "<line x1=\"%.1f\" y1=\"%u\" x2=\"%.1f\" y2=\"%u\"/>\n", p, top, p, bottom);
+	}
+
+	for (i = yFirst; i <= yLast; i++)
+	{
+		p = GetPlotY(i * ySpacing);
+		fprintf(file, "<line x1=\"%u\" y1=\"%.1f\" x2=\"%u\" y2=\"%.1f\"/>\n", left, p, right, p);
+	}
+
+	fprintf(file, "</g>\n<g fill=\"black\">\n");
+
+	for (i = xFirst; i <= xLast; i++)
+		fprintf(file, "<text x=\"%.1f\" y=\"%u\" text-anchor=\"middle\">%g</text>\n",
+			GetPlotX(i * xSpacing), bottom + 16, i * xSpacing);
+
+	for (i = yFirst; i <= yLast; i++)
+		fprintf(file, "<text x=\"%u\" y=\"%.1f\" text-anchor=\"end\">%g</text>\n",
+			left - 6, GetPlotY(i * ySpacing) + 4.0, i * ySpacing);
+
+	fprintf(file, "<text x=\"%u\" y=\"%u\" text-anchor=\"middle\" font-size=\"16\">%s</text>\n",
+		(left + right) / 2, top - 14, EscapeText(title).c_str());
+	fprintf(file, "<text x=\"%u\" y=\"%u\" text-anchor=\"middle\">%s</text>\n",
+		(left + right) / 2, height - 12, EscapeText(xLabel).c_str());
+	fprintf(file, "<text x=\"16\" y=\"%u\" text-anchor=\"middle\" transform=\"rotate(-90 16 %u)\">%s</text>\n",
+		(top + bottom) / 2, (top + bottom) / 2, EscapeText(yLabel).c_str());
+
+	fprintf(file, "</g>\n");
+	fprintf(file, "<rect x=\"%u\" y=\"%u\" width=\"%u\" height=\"%u\" fill=\"none\" stroke=\"black\"/>\n",
+		left, top, right - left, bottom - top);
+}
+
+//==========================================================================
+// Class:			ChartRenderer
+// Function:		WriteSeries
+//
+// Description:		Writes a data series as a polyline, clipped to the plot
+//					area.
+//
+// Input Arguments:
+//		file	= FILE*
+//		s		= const Series&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void ChartRenderer::WriteSeries(FILE *file, const Series &s) const
+{
+	if (s.x->empty())
+		return;
+
+	fprintf(file, "<polyline clip-path=\"url(#plotArea)\" fill=\"none\" stroke=\"%s\" stroke-width=\"2\" points=\"",
+		EscapeText(s.color).c_str());
+
+	unsigned int i;
+	for (i = 0; i < s.x->size(); i++)
+		fprintf(file, "%.1f,%.1f ", GetPlotX((*s.x)[i]), GetPlotY((*s.y)[i]));
+
+	fprintf(file, "\"/>\n");
+}
+
+//==========================================================================
+// Class:			ChartRenderer
+// Function:		WriteLegend
+//
+// Description:		Writes the legend in the upper left corner of the plot
+//					area.
+//
+// Input Arguments:
+//		file	= FILE*
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void ChartRenderer::WriteLegend(FILE *file) const
+{
+	const unsigned int entryHeight(18);// [px]
+	const unsigned int x(marginLeft + 10);
+
+	unsigned int i, y;
+	for (i = 0; i < series.size(); i++)
+	{
+		y = marginTop + 16 + i * entryHeight;
+		fprintf(file, "<line x1=\"%u\" y1=\"%u\" x2=\"%u\" y2=\"%u\" stroke=\"%s\" stroke-width=\"2\"/>\n",
+			x, y - 4, x + 24, y - 4, EscapeText(series[i].color).c_str());
+		fprintf(file, "<text x=\"%u\" y=\"%u\">%s</text>\n",
+			x + 30, y, EscapeText(series[i].title).c_str());
+	}
+}
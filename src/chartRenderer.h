@@ -0,0 +1,76 @@
+// File:  chartRenderer.h
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Copy:  (c) Copyright 2026
+// Desc:  In-process line chart renderer (axes, grid, title, labels, legend).
+//        Writes SVG directly to file, so no plotting process is required.
+//        Output is streamed through a fixed-size buffer and the image is
+//        replaced atomically, so readers never see a partially written file.
+
+#ifndef CHART_RENDERER_H_
+#define CHART_RENDERER_H_
+
+// Standard C++ headers
+#include <string>
+#include <vector>
+#include <iostream>
+#include <cstdio>
+
+class ChartRenderer
+{
+public:
+	ChartRenderer(std::ostream &outStream = std::cout,
+		unsigned int width = 800, unsigned int height = 600);
+
+	void SetTitle(const std::string &title) { this->title = title; };
+	void SetXLabel(const std::string &label) { xLabel = label; };
+	void SetYLabel(const std::string &label) { yLabel = label; };
+
+	void SetXRange(const double &min, const double &max);
+	void SetYRange(const double &min, const double &max);
+
+	// Series are not copied; the vectors must remain valid until Render()
+	// returns (or ClearSeries() is called)
+	void AddSeries(const std::vector<double> &x, const std::vector<double> &y,
+		const std::string &title, const std::string &color);
+	void ClearSeries(void) { series.clear(); };
+
+	bool Render(const std::string &fileName);
+
+private:
+	static const unsigned int marginLeft;// [px]
+	static const unsigned int marginRight;// [px]
+	static const unsigned int marginTop;// [px]
+	static const unsigned int marginBottom;// [px]
+	static const unsigned int targetTickCount;
+	static const unsigned int bufferSize;// [bytes]
+
+	std::ostream &outStream;
+
+	const unsigned int width, height;// [px]
+
+	std::string title, xLabel, yLabel;
+	double xMin, xMax, yMin, yMax;
+
+	struct Series
+	{
+		const std::vector<double> *x;
+		const std::vector<double> *y;
+		std::string title;
+		std::string color;
+	};
+
+	std::vector<Series> series;
+
+	double GetPlotX(const double &x) const;// [px]
+	double GetPlotY(const double &y) const;// [px]
+
+	static double GetTickSpacing(const double &range);
+	static std::string EscapeText(const std::string &text);
+
+	void WriteAxes(FILE *file) const;
+	void WriteSeries(FILE *file, const Series &s) const;
+	void WriteLegend(FILE *file) const;
+};
+
+#endif// CHART_RENDERER_H_
@@ -0,0 +1,35 @@
+// File:  dataSpan.h
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Copy:  (c) Copyright 2026
+// Desc:  Read-only view of a contiguous array of doubles.  Lets functions
+//        accept data held by a std::vector or by another object (e.g. a log
+//        reader) without copying it.  The viewed data must outlive the span.
+
+#ifndef DATA_SPAN_H_
+#define DATA_SPAN_H_
+
+// Standard C++ headers
+#include <cstddef>
+#include <vector>
+#include <cassert>
+
+struct DataSpan
+{
+	DataSpan() : data(NULL), count(0) {};
+	DataSpan(const double *data, const unsigned int &count) : data(data), count(count) {};
+
+	// Not explicit, so existing callers can keep passing vectors
+	DataSpan(const std::vector<double> &v) : data(v.empty() ? NULL : &v.front()), count(v.size()) {};
+
+	unsigned int size(void) const { return count; };
+	bool empty(void) const { return count == 0; };
+	const double& operator[](const unsigned int &i) const { assert(i < count); return data[i]; };
+	const double& front(void) const { assert(count > 0); return data[0]; };
+	const double& back(void) const { assert(count > 0); return data[count - 1]; };
+
+	const double *data;
+	unsigned int count;
+};
+
+#endif// DATA_SPAN_H_
@@ -0,0 +1,756 @@
+// File:  jsonReader.cpp
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Copy:  (c) Copyright 2026
+// Desc:  In-situ JSON reader.  Parses a single JSON object directly from a
+//        caller-owned, NUL-terminated buffer without allocating memory.  String
+//        values are unescaped and terminated in place (so the buffer is
+//        modified), and the reader keeps only pointers into the buffer, which
+//        must outlive the reader.  Members of the top-level object can be
+//        looked up by key; nested objects and arrays are validated but their
+//        contents are not accessible.
+
+// Standard C++ headers
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <climits>
+
+// Local headers
+#include "jsonReader.h"
+
+//==========================================================================
+// Class:			JSONReader
+// Function:		JSONReader
+//
+// Description:		Constructor for JSONReader class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+JSONReader::JSONReader()
+{
+	memberCount = 0;
+	start = NULL;
+	errorOffset = 0;
+	errorMessage = "";
+}
+
+//==========================================================================
+// Class:			JSONReader
+// Function:		Parse
+//
+// Description:		Parses the buffer, which must contain exactly one JSON
+//					object (surrounding whitespace is permitted).  Any
+//					results from previous calls are discarded.
+//
+// Input Arguments:
+//		buffer	= char*, NUL-terminated; modified by this call
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success, false if the input is malformed (see
+//		GetErrorOffset() and GetErrorMessage())
+//
+//==========================================================================
+bool JSONReader::Parse(char *buffer)
+{
+	start = buffer;
+	memberCount = 0;
+	errorOffset = 0;
+	errorMessage = "";
+
+	char *p(buffer);
+	SkipWhitespace(p);
+	if (*p != '{')
+		return SetError(p, "Expected '{'");
+
+	if (!ParseObject(p, 0, true))
+	{
+		memberCount = 0;
+		return false;
+	}
+
+	SkipWhitespace(p);
+	if (*p != '\0')
+	{
+		memberCount = 0;
+		return SetError(p, "Unexpected characters after object");
+	}
+
+	return true;
+}
+
+//==========================================================================
+// Class:			JSONReader
+// Function:		ParseObject
+//
+// Description:		Parses an object.
+//
+// Input Arguments:
+//		p		= char*&, pointing to the opening brace
+//		depth	= const unsigned int&, nesting level of this object
+//		store	= const bool&, true to record members for later lookup
+//
+// Output Arguments:
+//		p		= char*&, pointing to the character after the closing brace
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool JSONReader::ParseObject(char *&p, const unsigned int &depth, const bool &store)
+{
+	if (depth >= maxDepth)
+		return SetError(p, "Nesting too deep");
+
+	p++;
+	SkipWhitespace(p);
+	if (*p == '}')
+	{
+		p++;
+		return true;
+	}
+
+	const char *keyStart, *key, *value;
+	ValueType type;
+	while (true)
+	{
+		keyStart = p;
+		if (*p != '"')
+			return SetError(p, "Expected string key");
+		if (!ParseString(p, key))
+			return false;
+
+		SkipWhitespace(p);
+		if (*p != ':')
+			return SetError(p, "Expected ':'");
+		p++;
+		SkipWhitespace(p);
+
+		if (!ParseValue(p, depth, type, value))
+			return false;
+
+		if (store)
+		{
+			if (memberCount == maxMembers)
+				return SetError(keyStart, "Too many members");
+
+			members[memberCount].key = key;
+			members[memberCount].type = type;
+			members[memberCount].value = value;
+			memberCount++;
+		}
+
+		SkipWhitespace(p);
+		if (*p == '}')
+		{
+			p++;
+			return true;
+		}
+		else if (*p != ',')
+			return SetError(p, "Expected ',' or '}'");
+
+		p++;
+		SkipWhitespace(p);
+	}
+}
+
+//==========================================================================
+// Class:			JSONReader
+// Function:		ParseArray
+//
+// Description:		Parses (and discards) an array.
+//
+// Input Arguments:
+//		p		= char*&, pointing to the opening bracket
+//		depth	= const unsigned int&, nesting level of this array
+//
+// Output Arguments:
+//		p		= char*&, pointing to the character after the closing bracket
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool JSONReader::ParseArray(char *&p, const unsigned int &depth)
+{
+	if (depth >= maxDepth)
+		return SetError(p, "Nesting too deep");
+
+	p++;
+	SkipWhitespace(p);
+	if (*p == ']')
+	{
+		p++;
+		return true;
+	}
+
+	const char *value;
+	ValueType type;
+	while (true)
+	{
+		if (!ParseValue(p, depth, type, value))
+			return false;
+
+		SkipWhitespace(p);
+		if (*p == ']')
+		{
+			p++;
+			return true;
+		}
+		else if (*p != ',')
+			return SetError(p, "Expected ',' or ']'");
+
+		p++;
+		SkipWhitespace(p);
+	}
+}
+
+//==========================================================================
+// Class:			JSONReader
+// Function:		ParseValue
+//
+// Description:		Parses any value.
+//
+// Input Arguments:
+//		p		= char*&, pointing to the first character of the value
+//		depth	= const unsigned int&, nesting level of the containing object
+//				  or array
+//
+// Output Arguments:
+//		p		= char*&, pointing to the character after the value
+//		type	= ValueType&
+//		value	= const char*&, location of the value's text
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool JSONReader::ParseValue(char *&p, const unsigned int &depth,
+	ValueType &type, const char *&value)
+{
+	value = p;
+	switch (*p)
+	{
+	case '"':
+		type = TypeString;
+		return ParseString(p, value);
+
+	case '{':
+		type = TypeObject;
+		return ParseObject(p, depth + 1, false);
+
+	case '[':
+		type = TypeArray;
+		return ParseArray(p, depth + 1);
+
+	case 't':
+		type = TypeTrue;
+		return ParseLiteral(p, "true");
+
+	case 'f':
+		type = TypeFalse;
+		return ParseLiteral(p, "false");
+
+	case 'n':
+		type = TypeNull;
+		return ParseLiteral(p, "null");
+
+	case '\0':
+		return SetError(p, "Unexpected end of input");
+
+	default:
+		if (*p == '-' || (*p >= '0' && *p <= '9'))
+		{
+			type = TypeNumber;
+			return ParseNumber(p);
+		}
+	}
+
+	return SetError(p, "Expected value");
+}
+
+//==========================================================================
+// Class:			JSONReader
+// Function:		ParseString
+//
+// Description:		Parses a string, replacing escape sequences and the
+//					closing quote in place.
+//
+// Input Arguments:
+//		p		= char*&, pointing to the opening quote
+//
+// Output Arguments:
+//		p		= char*&, pointing to the character after the closing quote
+//		value	= const char*&, the unescaped, NUL-terminated string
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool JSONReader::ParseString(char *&p, const char *&value)
+{
+	p++;
+	char *w(p);
+	value = w;
+
+	unsigned int codePoint, lowSurrogate;
+	while (true)
+	{
+		if (*p == '"')
+		{
+			*w = '\0';
+			p++;
+			return true;
+		}
+		else if (*p == '\0')
+			return SetError(p, "Unterminated string");
+		else if ((unsigned char)*p < 0x20)
+			return SetError(p, "Control character in string");
+		else if (*p != '\\')
+		{
+			*w++ = *p++;
+			continue;
+		}
+
+		p++;
+		switch (*p)
+		{
+		case '"':
+		case '\\':
+		case '/':
+			*w++ = *p++;
+			break;
+
+		case 'b':
+			*w++ = '\b';
+			p++;
+			break;
+
+		case 'f':
+			*w++ = '\f';
+			p++;
+			break;
+
+		case 'n':
+			*w++ = '\n';
+			p++;
+			break;
+
+		case 'r':
+			*w++ = '\r';
+			p++;
+			break;
+
+		case 't':
+			*w++ = '\t';
+			p++;
+			break;
+
+		case 'u':
+			if (!ParseHex(p + 1, codePoint))
+				return SetError(p - 1, "Invalid \\u escape");
+			else if (codePoint == 0)
+				return SetError(p - 1, "Escaped NUL is not supported");
+			else if (codePoint >= 0xDC00 && codePoint <= 0xDFFF)
+				return SetError(p - 1, "Unpaired surrogate");
+			else if (codePoint >= 0xD800 && codePoint <= 0xDBFF)
+			{
+				if (p[5] != '\\' || p[6] != 'u' || !ParseHex(p + 7, lowSurrogate) ||
+					lowSurrogate < 0xDC00 || lowSurrogate > 0xDFFF)
+					return SetError(p - 1, "Unpaired surrogate");
+				codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (lowSurrogate - 0xDC00);
+				p += 6;
+			}
+
+			// Encoded form is never longer than the escape sequence
+			p += 5;
+			w = EncodeUTF8(w, codePoint);
+			break;
+
+		default:
+			return SetError(p - 1, "Invalid escape sequence");
+		}
+	}
+}
+
+//==========================================================================
+// Class:			JSONReader
+// Function:		ParseNumber
+//
+// Description:		Validates a number against the JSON grammar.  The number
+//					is not terminated; it is converted when it is read (the
+//					following character always ends the conversion).
+//
+// Input Arguments:
+//		p	= char*&, pointing to the first character of the number
+//
+// Output Arguments:
+//		p	= char*&, pointing to the character after the number
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool JSONReader::ParseNumber(char *&p)
+{
+	if (*p == '-')
+		p++;
+
+	if (*p == '0')
+	{
+		p++;
+		if (*p >= '0' && *p <= '9')
+			return SetError(p, "Leading zeros are not permitted");
+	}
+	else if (*p >= '1' && *p <= '9')
+	{
+		while (*p >= '0' && *p <= '9')
+			p++;
+	}
+	else
+		return SetError(p, "Invalid number");
+
+	if (*p == '.')
+	{
+		p++;
+		if (*p < '0' || *p > '9')
+			return SetError(p, "Expected digit after decimal point");
+		while (*p >= '0' && *p <= '9')
+			p++;
+	}
+
+	if (*p == 'e' || *p == 'E')
+	{
+		p++;
+		if (*p == '+' || *p == '-')
+			p++;
+		if (*p < '0' || *p > '9')
+			return SetError(p, "Expected digit in exponent");
+		while (*p >= '0' && *p <= '9')
+			p++;
+	}
+
+	return true;
+}
+
+//==========================================================================
+// Class:			JSONReader
+// Function:		ParseLiteral
+//
+// Description:		Parses one of the literals true, false or null.
+//
+// Input Arguments:
+//		p		= char*&, pointing to the first character of the literal
+//		literal	= const char*, the expected text
+//
+// Output Arguments:
+//		p		= char*&, pointing to the character after the literal
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool JSONReader::ParseLiteral(char *&p, const char *literal)
+{
+	const char *literalStart(p);
+	while (*literal)
+	{
+		if (*p++ != *literal++)
+			return SetError(literalStart, "Invalid literal");
+	}
+
+	return true;
+}
+
+//==========================================================================
+// Class:			JSONReader
+// Function:		ParseHex
+//
+// Description:		Parses the four hexadecimal digits of a \u escape.
+//
+// Input Arguments:
+//		p		= const char*
+//
+// Output Arguments:
+//		value	= unsigned int&
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool JSONReader::ParseHex(const char *p, unsigned int &value)
+{
+	value = 0;
+	unsigned int i;
+	for (i = 0; i < 4; i++)
+	{
+		value <<= 4;
+		if (p[i] >= '0' && p[i] <= '9')
+			value |= p[i] - '0';
+		else if (p[i] >= 'a' && p[i] <= 'f')
+			value |= p[i] - 'a' + 10;
+		else if (p[i] >= 'A' && p[i] <= 'F')
+			value |= p[i] - 'A' + 10;
+		else
+			return false;// Also stops at the terminator
+	}
+
+	return true;
+}
+
+//==========================================================================
+// Class:			JSONReader
+// Function:		SkipWhitespace
+//
+// Description:		Advances past any JSON whitespace.
+//
+// Input Arguments:
+//		p	= char*&
+//
+// Output Arguments:
+//		p	= char*&
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void JSONReader::SkipWhitespace(char *&p)
+{
+	while (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r')
+		p++;
+}
+
+//==========================================================================
+// Class:			JSONReader
+// Function:		EncodeUTF8
+//
+// Description:		Writes the code point as UTF-8.
+//
+// Input Arguments:
+//		p			= char*, destination
+//		codePoint	= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		char*, pointing to the byte following the encoded code point
+//
+//==========================================================================
+char *JSONReader::EncodeUTF8(char *p, const unsigned int &codePoint)
+{
+	if (codePoint < 0x80)
+		*p++ = codePoint;
+	else if (codePoint < 0x800)
+	{
+		*p++ = 0xC0 | (codePoint >> 6);
+		*p++ = 0x80 | (codePoint & 0x3F);
+	}
+	else if (codePoint < 0x10000)
+	{
+		*p++ = 0xE0 | (codePoint >> 12);
+		*p++ = 0x80 | ((codePoint >> 6) & 0x3F);
+		*p++ = 0x80 | (codePoint & 0x3F);
+	}
+	else
+	{
+		*p++ = 0xF0 | (codePoint >> 18);
+		*p++ = 0x80 | ((codePoint >> 12) & 0x3F);
+		*p++ = 0x80 | ((codePoint >> 6) & 0x3F);
+		*p++ = 0x80 | (codePoint & 0x3F);
+	}
+
+	return p;
+}
+
+//==========================================================================
+// Class:			JSONReader
+// Function:		SetError
+//
+// Description:		Records the location and description of a parse error.
+//
+// Input Arguments:
+//		p		= const char*, location of the error
+//		message	= const char*, must be a string literal
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, always false
+//
+//==========================================================================
+bool JSONReader::SetError(const char *p, const char *message)
+{
+	errorOffset = p - start;
+	errorMessage = message;
+	return false;
+}
+
+//==========================================================================
+// Class:			JSONReader
+// Function:		Find
+//
+// Description:		Finds the first member of the top-level object with the
+//					specified key.
+//
+// Input Arguments:
+//		key	= const char*
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		const Member*, NULL if not found
+//
+//==========================================================================
+const JSONReader::Member *JSONReader::Find(const char *key) const
+{
+	unsigned int i;
+	for (i = 0; i < memberCount; i++)
+	{
+		if (strcmp(members[i].key, key) == 0)
+			return &members[i];
+	}
+
+	return NULL;
+}
+
+//==========================================================================
+// Class:			JSONReader
+// Function:		HasKey
+//
+// Description:		Checks for the presence of the specified key.
+//
+// Input Arguments:
+//		key	= const char*
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if the key exists, false otherwise
+//
+//==========================================================================
+bool JSONReader::HasKey(const char *key) const
+{
+	return Find(key) != NULL;
+}
+
+//==========================================================================
+// Class:			JSONReader
+// Function:		Read
+//
+// Description:		Reads the numeric value associated with the specified key.
+//
+// Input Arguments:
+//		key		= const char*
+//
+// Output Arguments:
+//		value	= double&
+//
+// Return Value:
+//		bool, true if read is successful, false otherwise
+//
+//==========================================================================
+bool JSONReader::Read(const char *key, double &value) const
+{
+	const Member *member(Find(key));
+	if (!member || member->type != TypeNumber)
+		return false;
+
+	value = strtod(member->value, NULL);
+	return true;
+}
+
+//==========================================================================
+// Class:			JSONReader
+// Function:		Read
+//
+// Description:		Reads the integer value associated with the specified key.
+//					Fails if the value is not a whole number or is out of
+//					range.
+//
+// Input Arguments:
+//		key		= const char*
+//
+// Output Arguments:
+//		value	= int&
+//
+// Return Value:
+//		bool, true if read is successful, false otherwise
+//
+//==========================================================================
+bool JSONReader::Read(const char *key, int &value) const
+{
+	double doubleValue;
+	if (!Read(key, doubleValue) || doubleValue != floor(doubleValue) ||
+		doubleValue < INT_MIN || doubleValue > INT_MAX)
+		return false;
+
+	value = static_cast<int>(doubleValue);
+	return true;
+}
+
+//==========================================================================
+// Class:			JSONReader
+// Function:		Read
+//
+// Description:		Reads the boolean value associated with the specified key.
+//
+// Input Arguments:
+//		key		= const char*
+//
+// Output Arguments:
+//		value	= bool&
+//
+// Return Value:
+//		bool, true if read is successful, false otherwise
+//
+//==========================================================================
+bool JSONReader::Read(const char *key, bool &value) const
+{
+	const Member *member(Find(key));
+	if (!member || (member->type != TypeTrue && member->type != TypeFalse))
+		return false;
+
+	value = member->type == TypeTrue;
+	return true;
+}
+
+//==========================================================================
+// Class:			JSONReader
+// Function:		Read
+//
+// Description:		Reads the string value associated with the specified key.
+//
+// Input Arguments:
+//		key		= const char*
+//
+// Output Arguments:
+//		value	= const char*&, points into the parsed buffer
+//
+// Return Value:
+//		bool, true if read is successful, false otherwise
+//
+//==========================================================================
+bool JSONReader::Read(const char *key, const char *&value) const
+{
+	const Member *member(Find(key));
+	if (!member || member->type != TypeString)
+		return false;
+
+	value = member->value;
+	return true;
+}
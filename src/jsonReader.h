@@ -0,0 +1,79 @@
+// File:  jsonReader.h
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Copy:  (c) Copyright 2026
+// Desc:  In-situ JSON reader.  Parses a single JSON object directly from a
+//        caller-owned, NUL-terminated buffer without allocating memory.  String
+//        values are unescaped and terminated in place (so the buffer is
+//        modified), and the reader keeps only pointers into the buffer, which
+//        must outlive the reader.  Members of the top-level object can be
+//        looked up by key; nested objects and arrays are validated but their
+//        contents are not accessible.
+
+#ifndef JSON_READER_H_
+#define JSON_READER_H_
+
+class JSONReader
+{
+public:
+	JSONReader();
+
+	bool Parse(char *buffer);
+
+	// On failure, these describe the first problem found
+	unsigned int GetErrorOffset(void) const { return errorOffset; };// [bytes]
+	const char *GetErrorMessage(void) const { return errorMessage; };
+
+	// Return false if the key is missing or the value has the wrong type
+	bool Read(const char *key, double &value) const;
+	bool Read(const char *key, int &value) const;
+	bool Read(const char *key, bool &value) const;
+	bool Read(const char *key, const char *&value) const;
+	bool HasKey(const char *key) const;
+
+private:
+	static const unsigned int maxMembers = 16;
+	static const unsigned int maxDepth = 16;
+
+	enum ValueType
+	{
+		TypeString,
+		TypeNumber,
+		TypeTrue,
+		TypeFalse,
+		TypeNull,
+		TypeObject,
+		TypeArray
+	};
+
+	struct Member
+	{
+		const char *key;
+		ValueType type;
+		const char *value;// For strings (terminated) and numbers (not terminated)
+	};
+
+	Member members[maxMembers];
+	unsigned int memberCount;
+
+	const char *start;
+	unsigned int errorOffset;
+	const char *errorMessage;
+
+	bool ParseObject(char *&p, const unsigned int &depth, const bool &store);
+	bool ParseArray(char *&p, const unsigned int &depth);
+	bool ParseValue(char *&p, const unsigned int &depth, ValueType &type,
+		const char *&value);
+	bool ParseString(char *&p, const char *&value);
+	bool ParseNumber(char *&p);
+	bool ParseLiteral(char *&p, const char *literal);
+	bool ParseHex(const char *p, unsigned int &value);
+
+	static void SkipWhitespace(char *&p);
+	static char *EncodeUTF8(char *p, const unsigned int &codePoint);
+
+	bool SetError(const char *p, const char *message);
+	const Member *Find(const char *key) const;
+};
+
+#endif// JSON_READER_H_
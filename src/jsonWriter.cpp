@@ -0,0 +1,485 @@
+// File:  jsonWriter.cpp
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Copy:  (c) Copyright 2026
+// Desc:  Streaming JSON writer.  Writes compact JSON directly into a buffer
+//        supplied by the caller; no memory is allocated.  If the buffer is too
+//        small, writing stops, the output is truncated (but still terminated)
+//        and IsOK() returns false.
+
+// Standard C++ headers
+#include <cstdio>
+#include <cmath>
+#include <cfloat>
+#include <cassert>
+
+// Local headers
+#include "jsonWriter.h"
+
+//==========================================================================
+// Class:			JSONWriter
+// Function:		JSONWriter
+//
+// Description:		Constructor for JSONWriter class.
+//
+// Input Arguments:
+//		buffer	= char*, destination for output (owned by caller)
+//		size	= const unsigned int&, size of buffer, including space for
+//				  the terminating '\0'
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+JSONWriter::JSONWriter(char *buffer, const unsigned int &size)
+	: buffer(buffer), size(size)
+{
+	assert(buffer && size > 0);
+	Reset();
+}
+
+//==========================================================================
+// Class:			JSONWriter
+// Function:		Reset
+//
+// Description:		Discards any output and prepares to write a new document
+//					at the start of the buffer.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void JSONWriter::Reset(void)
+{
+	length = 0;
+	ok = true;
+	depth = 0;
+	hasMembers[0] = false;
+	Terminate();
+}
+
+//==========================================================================
+// Class:			JSONWriter
+// Function:		BeginObject
+//
+// Description:		Opens an object.
+//
+// Input Arguments:
+//		key	= const char*, NULL for top-level objects and array elements
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void JSONWriter::BeginObject(const char *key)
+{
+	BeginValue(key);
+	Push('{');
+
+	if (++depth >= maxDepth)
+		ok = false;
+	else
+		hasMembers[depth] = false;
+	Terminate();
+}
+
+//==========================================================================
+// Class:			JSONWriter
+// Function:		EndObject
+//
+// Description:		Closes the most recently opened object.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void JSONWriter::EndObject(void)
+{
+	assert(depth > 0);
+	depth--;
+	Push('}');
+	Terminate();
+}
+
+//==========================================================================
+// Class:			JSONWriter
+// Function:		BeginArray
+//
+// Description:		Opens an array.
+//
+// Input Arguments:
+//		key	= const char*, NULL for top-level arrays and array elements
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void JSONWriter::BeginArray(const char *key)
+{
+	BeginValue(key);
+	Push('[');
+
+	if (++depth >= maxDepth)
+		ok = false;
+	else
+		hasMembers[depth] = false;
+	Terminate();
+}
+
+//==========================================================================
+// Class:			JSONWriter
+// Function:		EndArray
+//
+// Description:		Closes the most recently opened array.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void JSONWriter::EndArray(void)
+{
+	assert(depth > 0);
+	depth--;
+	Push(']');
+	Terminate();
+}
+
+//==========================================================================
+// Class:			JSONWriter
+// Function:		Write
+//
+// Description:		Writes a string value.
+//
+// Input Arguments:
+//		key		= const char*
+//		value	= const char*
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void JSONWriter::Write(const char *key, const char *value)
+{
+	BeginValue(key);
+	PushEscaped(value);
+	Terminate();
+}
+
+//==========================================================================
+// Class:			JSONWriter
+// Function:		Write
+//
+// Description:		Writes a numeric value.  JSON has no representation for
+//					NaN or infinity, so these are written as null.
+//
+// Input Arguments:
+//		key		= const char*
+//		value	= const double&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void JSONWriter::Write(const char *key, const double &value)
+{
+	BeginValue(key);
+	if (value != value || fabs(value) > DBL_MAX)
+		Push("null");
+	else
+		PushFormatted("%.15g", value);
+	Terminate();
+}
+
+//==========================================================================
+// Class:			JSONWriter
+// Function:		Write
+//
+// Description:		Writes an integer value.
+//
+// Input Arguments:
+//		key		= const char*
+//		value	= const int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void JSONWriter::Write(const char *key, const int &value)
+{
+	BeginValue(key);
+	PushFormatted("%.0f", value);
+	Terminate();
+}
+
+//==========================================================================
+// Class:			JSONWriter
+// Function:		Write
+//
+// Description:		Writes a boolean value.
+//
+// Input Arguments:
+//		key		= const char*
+//		value	= const bool&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void JSONWriter::Write(const char *key, const bool &value)
+{
+	BeginValue(key);
+	Push(value ? "true" : "false");
+	Terminate();
+}
+
+//==========================================================================
+// Class:			JSONWriter
+// Function:		WriteNull
+//
+// Description:		Writes a null value.
+//
+// Input Arguments:
+//		key		= const char*
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void JSONWriter::WriteNull(const char *key)
+{
+	BeginValue(key);
+	Push("null");
+	Terminate();
+}
+
+//==========================================================================
+// Class:			JSONWriter
+// Function:		BeginValue
+//
+// Description:		Writes the separator (if required) and key (if provided)
+//					that precede a value.
+//
+// Input Arguments:
+//		key	= const char*, NULL if value has no key
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void JSONWriter::BeginValue(const char *key)
+{
+	if (depth >= maxDepth)
+		return;
+
+	if (hasMembers[depth])
+		Push(',');
+	hasMembers[depth] = true;
+
+	if (key)
+	{
+		PushEscaped(key);
+		Push(':');
+	}
+}
+
+//==========================================================================
+// Class:			JSONWriter
+// Function:		Push
+//
+// Description:		Appends a single character to the output.  Always leaves
+//					room for the terminator.
+//
+// Input Arguments:
+//		c	= const char&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void JSONWriter::Push(const char &c)
+{
+	if (!ok)
+		return;
+	else if (length + 1 >= size)
+	{
+		ok = false;
+		return;
+	}
+
+	buffer[length++] = c;
+}
+
+//==========================================================================
+// Class:			JSONWriter
+// Function:		Push
+//
+// Description:		Appends a string to the output (no escaping).
+//
+// Input Arguments:
+//		s	= const char*
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void JSONWriter::Push(const char *s)
+{
+	while (*s)
+		Push(*s++);
+}
+
+//==========================================================================
+// Class:			JSONWriter
+// Function:		PushEscaped
+//
+// Description:		Appends a quoted, escaped string to the output.
+//
+// Input Arguments:
+//		s	= const char*
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void JSONWriter::PushEscaped(const char *s)
+{
+	static const char hexDigits[] = "0123456789abcdef";
+
+	Push('"');
+	for (; *s && ok; s++)
+	{
+		const unsigned char c(*s);
+		if (c == '"' || c == '\\')
+		{
+			Push('\\');
+			Push(*s);
+		}
+		else if (c >= 0x20)
+			Push(*s);
+		else if (c == '\n')
+			Push("\\n");
+		else if (c == '\r')
+			Push("\\r");
+		else if (c == '\t')
+			Push("\\t");
+		else if (c == '\b')
+			Push("\\b");
+		else if (c == '\f')
+			Push("\\f");
+		else
+		{
+			Push("\\u00");
+			Push(hexDigits[c >> 4]);
+			Push(hexDigits[c & 0x0F]);
+		}
+	}
+	Push('"');
+}
+
+//==========================================================================
+// Class:			JSONWriter
+// Function:		PushFormatted
+//
+// Description:		Formats a number directly into the output buffer.
+//
+// Input Arguments:
+//		format	= const char*, printf-style format for a single double
+//		value	= const double&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void JSONWriter::PushFormatted(const char *format, const double &value)
+{
+	if (!ok)
+		return;
+
+	const unsigned int available(size - length);
+	const int written(snprintf(buffer + length, available, format, value));
+	if (written < 0 || (unsigned int)written >= available)
+	{
+		ok = false;
+		return;
+	}
+
+	length += written;
+}
+
+//==========================================================================
+// Class:			JSONWriter
+// Function:		Terminate
+//
+// Description:		Terminates the output string.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void JSONWriter::Terminate(void)
+{
+	buffer[length] = '\0';
+}
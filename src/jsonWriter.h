@@ -0,0 +1,61 @@
+// File:  jsonWriter.h
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Copy:  (c) Copyright 2026
+// Desc:  Streaming JSON writer.  Writes compact JSON directly into a buffer
+//        supplied by the caller; no memory is allocated.  If the buffer is too
+//        small, writing stops, the output is truncated (but still terminated)
+//        and IsOK() returns false.
+
+#ifndef JSON_WRITER_H_
+#define JSON_WRITER_H_
+
+// Standard C++ headers
+#include <cstddef>
+
+class JSONWriter
+{
+public:
+	JSONWriter(char *buffer, const unsigned int &size);
+
+	void Reset(void);
+
+	void BeginObject(const char *key = NULL);
+	void EndObject(void);
+	void BeginArray(const char *key = NULL);
+	void EndArray(void);
+
+	// Pass NULL for key when writing array elements
+	void Write(const char *key, const char *value);
+	void Write(const char *key, const double &value);
+	void Write(const char *key, const int &value);
+	void Write(const char *key, const bool &value);
+	void WriteNull(const char *key);
+
+	bool IsOK(void) const { return ok; };
+	const char *GetString(void) const { return buffer; };
+	unsigned int GetLength(void) const { return length; };// Excludes terminator
+
+private:
+	static const unsigned int maxDepth = 16;
+
+	char* const buffer;
+	const unsigned int size;
+
+	unsigned int length;
+	bool ok;
+
+	// Whether a value has been written at each nesting level (so we know
+	// when a separator is required)
+	unsigned int depth;
+	bool hasMembers[maxDepth];
+
+	void BeginValue(const char *key);
+	void Push(const char &c);
+	void Push(const char *s);
+	void PushEscaped(const char *s);
+	void PushFormatted(const char *format, const double &value);
+	void Terminate(void);
+};
+
+#endif// JSON_WRITER_H_
@@ -6,6 +6,7 @@
 
 // Standard C++ headers
 #include <cstdlib>
+#include <algorithm>
 #include <cassert>
 #include <errno.h>
 #include <fcntl.h>
@@ -20,9 +21,13 @@
 #include <netinet/in.h>
 #include <netdb.h>
 #include <signal.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/uio.h>
 
 // Local headers
 #include "linuxSocket.h"
+#include "workerThread.h"
 
 using namespace std;
 
@@ -43,8 +48,11 @@ using namespace std;
 //
 //==========================================================================
 const unsigned int LinuxSocket::maxMessageSize = 1024;
-const unsigned int LinuxSocket::maxConnections = 5;
-const unsigned int LinuxSocket::selectTimeout = 5;// [sec]
+const unsigned int LinuxSocket::maxFrameSize = 65536;// [bytes, including delimiter]
+const char LinuxSocket::frameDelimiter = '\n';
+const unsigned int LinuxSocket::sendQueueSize = 65536;// [bytes per client]
+const unsigned int LinuxSocket::maxConnections = SOMAXCONN;// [listen backlog]
+const unsigned int LinuxSocket::maxEvents = 64;// [per call to epoll_wait()]
 
 //==========================================================================
 // Class:			LinuxSocket
@@ -65,7 +73,18 @@ const unsigned int LinuxSocket::selectTimeout = 5;// [sec]
 LinuxSocket::LinuxSocket(SocketType type, ostream& outStream) : type(type), outStream(outStream)
 {
 	clientMessageSize = 0;
+	messageHandler = NULL;
+	handlerContext = NULL;
+	continueListening = false;
+	listenerRunning = false;
+	epollFD = SOCKET_ERROR;
+	wakeFD = SOCKET_ERROR;
 	pthread_mutex_init(&bufferMutex, NULL);
+	pthread_mutex_init(&clientMutex, NULL);
+
+	sendStatistics.bytesQueued = 0;
+	sendStatistics.bytesDropped = 0;
+	sendStatistics.clientsDropped = 0;
 
 	rcvBuffer = new unsigned char[maxMessageSize];
 }
@@ -90,14 +109,26 @@ LinuxSocket::~LinuxSocket()
 {
 	continueListening = false;
 	int errorNumber;
-	if (type == SocketTCPServer)
+	if (listenerRunning)
 	{
+		WakeListenThread();
 		if ((errorNumber = pthread_join(listenerThread, NULL)) != 0)
-			outStream << "Error destroying mutex (" << errorNumber << ")" << endl;
+			outStream << "Error joining listener thread (" << errorNumber << ")" << endl;
 	}
 
+	std::map<int, SendQueue>::const_iterator it;
+	for (it = clients.begin(); it != clients.end(); ++it)
+		close(it->first);
+
+	if (epollFD != SOCKET_ERROR)
+		close(epollFD);
+	if (wakeFD != SOCKET_ERROR)
+		close(wakeFD);
+
 	if ((errorNumber = pthread_mutex_destroy(&bufferMutex)) != 0)
 		outStream << "Error destroying mutex (" << errorNumber << ")" << endl;
+	if ((errorNumber = pthread_mutex_destroy(&clientMutex)) != 0)
+		outStream << "Error destroying mutex (" << errorNumber << ")" << endl;
 
 	delete [] rcvBuffer;
 	rcvBuffer = NULL;
@@ -151,6 +182,34 @@ bool LinuxSocket::Create(const unsigned short &port, const string &target)
 	return true;
 }
 
+//==========================================================================
+// Class:			LinuxSocket
+// Function:		SetMessageHandler
+//
+// Description:		Sets the function to be called (from the listener thread)
+//					each time a TCP server receives a message.  Must be called
+//					prior to Create().
+//
+// Input Arguments:
+//		handler	= MessageHandler
+//		context	= void*, passed to the handler with each message
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void LinuxSocket::SetMessageHandler(MessageHandler handler, void *context)
+{
+	assert(type == SocketTCPServer);
+	assert(!listenerRunning);
+
+	messageHandler = handler;
+	handlerContext = context;
+}
+
 //==========================================================================
 // Class:			LinuxSocket
 // Function:		AssembleAddress
@@ -245,8 +304,9 @@ void *LaunchThread(void *pThisSocket)
 // Class:			LinuxSocket
 // Function:		Listen
 //
-// Description:		Spawns a new thread and puts the socket in a listen state
-//					(in the new thread).
+// Description:		Puts the socket in a listen state, creates the epoll
+//					instance used to monitor the server and its clients and
+//					spawns the thread that services it.
 //
 // Input Arguments:
 //		None
@@ -273,15 +333,101 @@ bool LinuxSocket::Listen(void)
 
 	outStream << "  Socket " << sock << " listening" << endl;
 
-	if (pthread_create(&listenerThread, NULL, &LaunchThread, (void*)this) == 0)
+	// Edge-triggered notifications require that we always read (or accept)
+	// until the call would block, so the listening socket must never block
+	if (!SetBlocking(sock, false))
+	{
+		outStream << "  Failed to set non-blocking mode for socket " << sock << ":  " << GetLastError() << endl;
+		return false;
+	}
+
+	epollFD = epoll_create1(0);
+	if (epollFD == SOCKET_ERROR)
+	{
+		outStream << "  Failed to create epoll instance:  " << GetLastError() << endl;
+		return false;
+	}
+
+	wakeFD = eventfd(0, EFD_NONBLOCK);
+	if (wakeFD == SOCKET_ERROR)
+	{
+		outStream << "  Failed to create wake event:  " << GetLastError() << endl;
+		return false;
+	}
+
+	if (!AddToEventLoop(wakeFD) || !AddToEventLoop(sock))
+		return false;
+
+	if (WorkerThread::Create(listenerThread, &LaunchThread, (void*)this) == 0)
 	{
+		listenerRunning = true;
 		outStream << "  Spawned listening thread with ID " << listenerThread << endl;
 		return true;
 	}
 
+	continueListening = false;
 	return false;
 }
 
+//==========================================================================
+// Class:			LinuxSocket
+// Function:		AddToEventLoop
+//
+// Description:		Registers the specified file descriptor with the epoll
+//					instance (edge-triggered, read events and optionally
+//					write events).
+//
+// Input Arguments:
+//		fd				= int
+//		monitorWrite	= bool
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if successful, false otherwise
+//
+//==========================================================================
+bool LinuxSocket::AddToEventLoop(int fd, bool monitorWrite)
+{
+	struct epoll_event event;
+	memset(&event, 0, sizeof(event));
+	event.events = EPOLLIN | EPOLLET;
+	if (monitorWrite)
+		event.events |= EPOLLOUT;
+	event.data.fd = fd;
+
+	if (epoll_ctl(epollFD, EPOLL_CTL_ADD, fd, &event) == SOCKET_ERROR)
+	{
+		outStream << "  Failed to add descriptor " << fd << " to epoll instance:  " << GetLastError() << endl;
+		return false;
+	}
+
+	return true;
+}
+
+//==========================================================================
+// Class:			LinuxSocket
+// Function:		WakeListenThread
+//
+// Description:		Interrupts the listener thread's call to epoll_wait().
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void LinuxSocket::WakeListenThread(void)
+{
+	if (eventfd_write(wakeFD, 1) == SOCKET_ERROR)
+		outStream << "  Failed to wake listener thread:  " << GetLastError() << endl;
+}
+
 //==========================================================================
 // Class:			LinuxSocket
 // Function:		ListenThreadEntry
@@ -289,7 +435,10 @@ bool LinuxSocket::Listen(void)
 // Description:		Listener thread entry point.  Listening, accepting
 //					connections and receiving data happens in this thread,
 //					but access to the data and sends are handled in the main
-//					thread.
+//					thread.  Blocks in epoll_wait() until a descriptor is
+//					ready or the wake event is signalled (on destruction or
+//					when outbound data is queued).  All sends to clients are
+//					performed here.
 //
 // Input Arguments:
 //		None
@@ -303,52 +452,107 @@ bool LinuxSocket::Listen(void)
 //==========================================================================
 void LinuxSocket::ListenThreadEntry(void)
 {
-	FD_ZERO(&clients);
-	FD_SET(sock, &clients);
-	maxSock = sock;
-
-	struct timeval timeout;
-	timeout.tv_sec = selectTimeout;
-	timeout.tv_usec = 0;
+	std::vector<struct epoll_event> events(maxEvents);
+	eventfd_t wakeCount;
 
-	int s;
+	int i, eventCount;
+	bool flushNeeded;
 	while (continueListening)
 	{
-		readSocks = clients;
-		if (select(maxSock + 1, &readSocks, NULL, NULL, &timeout) == SOCKET_ERROR)
+		eventCount = epoll_wait(epollFD, &events.front(), maxEvents, -1);
+		if (eventCount == SOCKET_ERROR)
 		{
-			outStream << "  Failed to select sockets:  " << GetLastError() << std::endl;
+			if (errno != EINTR)
+				outStream << "  Failed to wait for socket events:  " << GetLastError() << std::endl;
 			continue;
 		}
 
-		for (s = 0; s <= maxSock; s++)
+		flushNeeded = false;
+		for (i = 0; i < eventCount; i++)
 		{
-			if (FD_ISSET(s, &readSocks))
+			if (events[i].data.fd == wakeFD)
 			{
-				// Socket ID s is ready
-				if (s == sock)// New connection
-				{
-					int newSock;
-					struct sockaddr_in clientAddress;
-					unsigned int size = sizeof(struct sockaddr_in);
-					newSock = accept(sock, (struct sockaddr*)&clientAddress, &size);
-					if (newSock == SOCKET_ERROR)
-					{
-						outStream << "  Failed to accept connection:  " << GetLastError() << std::endl;
-						continue;
-					}
-
-					/*cout << "  connection from: " << inet_ntoa(clientAddress.sin_addr
-						<< ":" << ntohs(clientAddress.sin_port) << endl;//*/
-
-					FD_SET(newSock, &clients);
-					if (newSock > maxSock)
-						maxSock = newSock;
-				}
-				else
-					HandleClient(s);
+				eventfd_read(wakeFD, &wakeCount);
+				flushNeeded = true;
+			}
+			else if (events[i].data.fd == sock)// New connection(s)
+				AcceptConnections();
+			else
+			{
+				if ((events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR)) &&
+					!HandleClient(events[i].data.fd))
+					continue;// Client was disconnected
+
+				if (events[i].events & EPOLLOUT)
+					flushNeeded = true;
 			}
 		}
+
+		if (flushNeeded)
+			FlushAll();
+		DisconnectLaggingClients();
+	}
+}
+
+//==========================================================================
+// Class:			LinuxSocket
+// Function:		AcceptConnections
+//
+// Description:		Accepts all pending connections on the listening socket.
+//					With edge-triggered notification, we must continue until
+//					accept() would block.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void LinuxSocket::AcceptConnections(void)
+{
+	int newSock;
+	struct sockaddr_in clientAddress;
+	socklen_t size;
+	while (true)
+	{
+		size = sizeof(struct sockaddr_in);
+		newSock = accept(sock, (struct sockaddr*)&clientAddress, &size);
+		if (newSock == SOCKET_ERROR)
+		{
+			if (errno == EINTR)
+				continue;
+			else if (errno != EAGAIN && errno != EWOULDBLOCK)
+				outStream << "  Failed to accept connection:  " << GetLastError() << std::endl;
+			return;
+		}
+
+		/*cout << "  connection from: " << inet_ntoa(clientAddress.sin_addr
+			<< ":" << ntohs(clientAddress.sin_port) << endl;//*/
+
+		if (!SetBlocking(newSock, false) || !AddToEventLoop(newSock, true))
+		{
+			close(newSock);
+			continue;
+		}
+
+		if (messageHandler)
+		{
+			FrameBuffer &frameBuffer(frameBuffers[newSock]);
+			frameBuffer.data.resize(maxMessageSize);
+			frameBuffer.used = 0;
+		}
+
+		pthread_mutex_lock(&clientMutex);
+		SendQueue &queue(clients[newSock]);
+		queue.data.resize(sendQueueSize);
+		queue.head = 0;
+		queue.count = 0;
+		queue.disconnectPending = false;
+		pthread_mutex_unlock(&clientMutex);
 	}
 }
 
@@ -356,34 +560,190 @@ void LinuxSocket::ListenThreadEntry(void)
 // Class:			LinuxSocket
 // Function:		HandleClient
 //
-// Description:		Handles incomming requests from client sockets.
+// Description:		Handles incomming requests from client sockets.  Reads
+//					until recv() would block, as required for edge-triggered
+//					notification.  If a message handler was set, complete
+//					frames are passed to it, otherwise raw messages are made
+//					available through Receive() and GetLastMessage().
 //
 // Input Arguments:
-//		newSock	= int
+//		clientSock	= int
 //
 // Output Arguments:
 //		None
 //
 // Return Value:
+//		bool, true if the client is still connected, false otherwise
+//
+//==========================================================================
+bool LinuxSocket::HandleClient(int clientSock)
+{
+	int errorNumber, messageSize, receiveError;
+	while (true)
+	{
+		if (messageHandler)
+		{
+			std::map<int, FrameBuffer>::iterator it(frameBuffers.find(clientSock));
+			assert(it != frameBuffers.end());
+			messageSize = ReceiveFrames(clientSock, it->second);
+			receiveError = errno;
+		}
+		else
+		{
+			if ((errorNumber = pthread_mutex_lock(&bufferMutex)) != 0)
+				outStream << "  Error locking mutex (" << errorNumber << ")" << endl;
+			messageSize = DoReceive(clientSock, NULL, MSG_DONTWAIT);
+			receiveError = errno;
+			if (messageSize > 0)
+				clientMessageSize = messageSize;
+			if ((errorNumber = pthread_mutex_unlock(&bufferMutex)) != 0)
+				outStream << "  Error unlocking mutex (" << errorNumber << ")" << endl;
+		}
+
+		if (messageSize > 0)
+			continue;
+		else if (messageSize == SOCKET_ERROR &&
+			(receiveError == EAGAIN || receiveError == EWOULDBLOCK))
+			return true;// Nothing more to read for now
+		else if (messageSize == SOCKET_ERROR && receiveError == EINTR)
+			continue;
+
+		break;
+	}
+
+	// On disconnect (or unrecoverable error)
+	DisconnectClient(clientSock);
+	return false;
+}
+
+//==========================================================================
+// Class:			LinuxSocket
+// Function:		ReceiveFrames
+//
+// Description:		Receives data from the specified client directly into the
+//					unused tail of its reassembly buffer, then dispatches any
+//					complete frames.  The buffer grows as needed, up to
+//					maxFrameSize.
+//
+// Input Arguments:
+//		clientSock	= int
+//		frameBuffer	= FrameBuffer&
+//
+// Output Arguments:
 //		None
 //
+// Return Value:
+//		int specifying bytes received, or SOCKET_ERROR on error (errno is
+//		set to EMSGSIZE if a frame exceeds the maximum size)
+//
 //==========================================================================
-void LinuxSocket::HandleClient(int newSock)
+int LinuxSocket::ReceiveFrames(int clientSock, FrameBuffer &frameBuffer)
 {
-	int errorNumber;
-	if ((errorNumber = pthread_mutex_lock(&bufferMutex)) != 0)
-		outStream << "  Error locking mutex (" << errorNumber << ")" << endl;
-	clientMessageSize = DoReceive(newSock);
-	if ((errorNumber = pthread_mutex_unlock(&bufferMutex)) != 0)
-		outStream << "  Error unlocking mutex (" << errorNumber << ")" << endl;
+	if (frameBuffer.used == frameBuffer.data.size())
+	{
+		if (frameBuffer.data.size() >= maxFrameSize)
+		{
+			outStream << "  Frame from client " << clientSock
+				<< " exceeds maximum size of " << maxFrameSize << " bytes" << endl;
+			errno = EMSGSIZE;
+			return SOCKET_ERROR;
+		}
 
-	// On disconnect
-	if (clientMessageSize <= 0)
+		frameBuffer.data.resize(std::min((unsigned int)frameBuffer.data.size() * 2, maxFrameSize));
+	}
+
+	const int bytesReceived(recv(clientSock, &frameBuffer.data[frameBuffer.used],
+		frameBuffer.data.size() - frameBuffer.used, MSG_DONTWAIT));
+	if (bytesReceived > 0)
 	{
-		outStream << "  Client " << newSock << " disconnected" << std::endl;
-		FD_CLR(newSock, &clients);
-		close(newSock);
+		const unsigned int scanStart(frameBuffer.used);
+		frameBuffer.used += bytesReceived;
+		DispatchFrames(frameBuffer, scanStart);
 	}
+
+	return bytesReceived;
+}
+
+//==========================================================================
+// Class:			LinuxSocket
+// Function:		DispatchFrames
+//
+// Description:		Passes each complete frame in the buffer to the message
+//					handler.  Delimiters are replaced in place with '\0' (a
+//					trailing '\r' is also stripped), so frames are handed out
+//					without copying.  Any partial frame is moved to the front
+//					of the buffer.
+//
+// Input Arguments:
+//		frameBuffer	= FrameBuffer&
+//		scanStart	= const unsigned int&, offset of first byte not yet
+//					  searched for a delimiter
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void LinuxSocket::DispatchFrames(FrameBuffer &frameBuffer, const unsigned int &scanStart)
+{
+	unsigned char *start(&frameBuffer.data.front());
+	unsigned char *end(start + frameBuffer.used);
+	unsigned char *frame(start);
+	unsigned char *delimiter(start + scanStart);
+	int frameSize;
+
+	while ((delimiter = static_cast<unsigned char*>(
+		memchr(delimiter, frameDelimiter, end - delimiter))) != NULL)
+	{
+		*delimiter = '\0';
+		frameSize = delimiter - frame;
+		if (frameSize > 0 && frame[frameSize - 1] == '\r')
+			frame[--frameSize] = '\0';
+
+		if (frameSize > 0)// Ignore empty lines
+			messageHandler(handlerContext, frame, frameSize);
+
+		frame = ++delimiter;
+	}
+
+	if (frame != start)
+	{
+		frameBuffer.used = end - frame;
+		memmove(start, frame, frameBuffer.used);
+	}
+}
+
+//==========================================================================
+// Class:			LinuxSocket
+// Function:		DisconnectClient
+//
+// Description:		Closes the specified client socket and removes it from
+//					the list of clients.
+//
+// Input Arguments:
+//		clientSock	= int
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void LinuxSocket::DisconnectClient(int clientSock)
+{
+	outStream << "  Client " << clientSock << " disconnected" << std::endl;
+
+	pthread_mutex_lock(&clientMutex);
+	clients.erase(clientSock);
+	pthread_mutex_unlock(&clientMutex);
+
+	frameBuffers.erase(clientSock);
+
+	// Closing the socket also removes it from the epoll instance
+	close(clientSock);
 }
 
 //==========================================================================
@@ -460,17 +820,44 @@ bool LinuxSocket::EnableAddressReusue(void)
 //
 //==========================================================================
 bool LinuxSocket::SetBlocking(bool blocking)
+{
+	// The listener thread requires a non-blocking listening socket, so
+	// TCP servers ignore this request
+	if (type == SocketTCPServer)
+		return true;
+
+	return SetBlocking(sock, blocking);
+}
+
+//==========================================================================
+// Class:			LinuxSocket
+// Function:		SetBlocking
+//
+// Description:		Sets the blocking mode of the specified socket.
+//
+// Input Arguments:
+//		fd			= int
+//		blocking	= bool specifying whether socket operations should block or not
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool LinuxSocket::SetBlocking(int fd, bool blocking)
 {
 #ifdef WIN32
 	unsigned long mode = blocking ? 0 : 1;// 1 = Non-Blocking, 0 = Blocking
-	return ioctlsocket(sock, FIONBIO, &mode) == 0;
+	return ioctlsocket(fd, FIONBIO, &mode) == 0;
 #else
-	int flags = fcntl(sock, F_GETFL, 0);
+	int flags = fcntl(fd, F_GETFL, 0);
 	if (flags < 0)
 		return false;
 
 	flags = blocking ? (flags &~ O_NONBLOCK) : (flags | O_NONBLOCK);
-	return fcntl(sock, F_SETFL, flags) == 0;
+	return fcntl(fd, F_SETFL, flags) == 0;
 #endif
 }
 
@@ -532,6 +919,7 @@ int LinuxSocket::Receive(void)
 // Input Arguments:
 //		sock		= int
 //		senderAddr	= struct sockaddr_in*
+//		flags		= int, passed to recv()
 //
 // Output Arguments:
 //		None
@@ -540,16 +928,16 @@ int LinuxSocket::Receive(void)
 //		int specifying bytes received, or SOCKET_ERROR on error
 //
 //==========================================================================
-int LinuxSocket::DoReceive(int sock, struct sockaddr_in *senderAddr)
+int LinuxSocket::DoReceive(int sock, struct sockaddr_in *senderAddr, int flags)
 {
 	if (senderAddr)
 	{
 		socklen_t addrSize = sizeof(*senderAddr);
-		return recvfrom(sock, rcvBuffer, maxMessageSize, 0, (struct sockaddr*)senderAddr, &addrSize);
+		return recvfrom(sock, rcvBuffer, maxMessageSize, flags, (struct sockaddr*)senderAddr, &addrSize);
 	}
 	else
 	{
-		return recv(sock, rcvBuffer, maxMessageSize, 0);
+		return recv(sock, rcvBuffer, maxMessageSize, flags);
 	}
 }
 
@@ -644,7 +1032,10 @@ bool LinuxSocket::TCPSend(const void *buffer, const int &bufferSize)
 // Class:			LinuxSocket
 // Function:		TCPServerSend
 //
-// Description:		Sends a message to all of the connected clients (TCP).
+// Description:		Queues a message for all of the connected clients (TCP).
+//					Never blocks on the network; the listener thread is woken
+//					to perform the sends.  A client whose queue cannot hold
+//					the message is flagged for disconnection.
 //
 // Input Arguments:
 //		buffer		= const void* pointing to the message body contents
@@ -659,30 +1050,201 @@ bool LinuxSocket::TCPSend(const void *buffer, const int &bufferSize)
 //==========================================================================
 bool LinuxSocket::TCPServerSend(const void *buffer, const int &bufferSize)
 {
-	int bytesSent, s;
 	bool success(true), calledSend(false);
 
-	for (s = 0; s <= maxSock; s++)
+	pthread_mutex_lock(&clientMutex);
+	std::map<int, SendQueue>::iterator it;
+	for (it = clients.begin(); it != clients.end(); ++it)
 	{
-		if (!FD_ISSET(s, &clients) || s == sock)
+		if (it->second.disconnectPending)
 			continue;
 
-		bytesSent = send(s, buffer, bufferSize, 0);
 		calledSend = true;
-
-		if (bytesSent == SOCKET_ERROR)
+		if (Enqueue(it->second, static_cast<const unsigned char*>(buffer), bufferSize))
+			sendStatistics.bytesQueued += bufferSize;
+		else
 		{
-			outStream << "  Error sending TCP message on socket " << s << ": " << GetLastError() << endl;
+			outStream << "  Send queue full for socket " << it->first << "; disconnecting" << endl;
+			sendStatistics.bytesDropped += bufferSize;
+			it->second.disconnectPending = true;
 			success = false;
 		}
-		else if (bytesSent != bufferSize)
+	}
+	pthread_mutex_unlock(&clientMutex);
+
+	if (calledSend)
+		WakeListenThread();
+
+	return success && calledSend;
+}
+
+//==========================================================================
+// Class:			LinuxSocket
+// Function:		Enqueue
+//
+// Description:		Copies the message into the client's send queue, if there
+//					is room for all of it.  Caller must hold clientMutex.
+//
+// Input Arguments:
+//		queue	= SendQueue&
+//		buffer	= const unsigned char*
+//		size	= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if the message was queued, false if there was not room
+//
+//==========================================================================
+bool LinuxSocket::Enqueue(SendQueue &queue, const unsigned char *buffer,
+	const unsigned int &size)
+{
+	const unsigned int capacity(queue.data.size());
+	if (size > capacity - queue.count)
+		return false;
+
+	const unsigned int tail((queue.head + queue.count) % capacity);
+	const unsigned int firstPart(std::min(size, capacity - tail));
+	memcpy(&queue.data[tail], buffer, firstPart);
+	memcpy(&queue.data[0], buffer + firstPart, size - firstPart);
+	queue.count += size;
+
+	return true;
+}
+
+//==========================================================================
+// Class:			LinuxSocket
+// Function:		Flush
+//
+// Description:		Writes as much of the client's send queue as the socket
+//					will accept without blocking.  The queue is written with
+//					a single call to writev() (two segments if it wraps).
+//					Caller must hold clientMutex.
+//
+// Input Arguments:
+//		clientSock	= int
+//		queue		= SendQueue&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true unless an error occured (in which case the client is
+//		flagged for disconnection)
+//
+//==========================================================================
+bool LinuxSocket::Flush(int clientSock, SendQueue &queue)
+{
+	const unsigned int capacity(queue.data.size());
+	struct iovec segments[2];
+	int segmentCount;
+	ssize_t bytesSent;
+
+	while (queue.count > 0)
+	{
+		segments[0].iov_base = &queue.data[queue.head];
+		segments[0].iov_len = std::min(queue.count, capacity - queue.head);
+		segmentCount = 1;
+		if (segments[0].iov_len < queue.count)
 		{
-			outStream << "  Wrong number of bytes sent (TCP) on socket "<< s << endl;
-			success = false;
+			segments[1].iov_base = &queue.data[0];
+			segments[1].iov_len = queue.count - segments[0].iov_len;
+			segmentCount = 2;
+		}
+
+		bytesSent = writev(clientSock, segments, segmentCount);
+		if (bytesSent == SOCKET_ERROR)
+		{
+			if (errno == EINTR)
+				continue;
+			else if (errno == EAGAIN || errno == EWOULDBLOCK)
+				return true;// We'll be notified (EPOLLOUT) when there is room
+
+			outStream << "  Error sending TCP message on socket " << clientSock << ": " << GetLastError() << endl;
+			queue.disconnectPending = true;
+			return false;
 		}
+
+		queue.head = (queue.head + bytesSent) % capacity;
+		queue.count -= bytesSent;
 	}
 
-	return success && calledSend;
+	return true;
+}
+
+//==========================================================================
+// Class:			LinuxSocket
+// Function:		FlushAll
+//
+// Description:		Flushes the send queues for all clients.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void LinuxSocket::FlushAll(void)
+{
+	pthread_mutex_lock(&clientMutex);
+	std::map<int, SendQueue>::iterator it;
+	for (it = clients.begin(); it != clients.end(); ++it)
+	{
+		if (!it->second.disconnectPending)
+			Flush(it->first, it->second);
+	}
+	pthread_mutex_unlock(&clientMutex);
+}
+
+//==========================================================================
+// Class:			LinuxSocket
+// Function:		DisconnectLaggingClients
+//
+// Description:		Disconnects any clients that were flagged due to send
+//					queue overflow or send errors, and logs the send
+//					statistics when any are disconnected.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void LinuxSocket::DisconnectLaggingClients(void)
+{
+	std::vector<int> laggingClients;
+
+	pthread_mutex_lock(&clientMutex);
+	std::map<int, SendQueue>::const_iterator it;
+	for (it = clients.begin(); it != clients.end(); ++it)
+	{
+		if (it->second.disconnectPending)
+			laggingClients.push_back(it->first);
+	}
+	sendStatistics.clientsDropped += laggingClients.size();
+	const SendStatistics statistics(sendStatistics);
+	pthread_mutex_unlock(&clientMutex);
+
+	if (laggingClients.empty())
+		return;
+
+	unsigned int i;
+	for (i = 0; i < laggingClients.size(); i++)
+		DisconnectClient(laggingClients[i]);
+
+	outStream << "  Send statistics for socket " << sock << ":  "
+		<< statistics.bytesQueued << " bytes queued, "
+		<< statistics.bytesDropped << " bytes dropped, "
+		<< statistics.clientsDropped << " clients dropped" << endl;
 }
 
 //==========================================================================
@@ -885,13 +1447,36 @@ unsigned int LinuxSocket::GetClientCount(void) const
 {
 	assert(type == SocketTCPServer);
 
-	int s, count(0);
-	for (s = 0; s <= maxSock; s++)
-	{
-		if (!FD_ISSET(s, &clients) || s == sock)
-			continue;
-		count++;
-	}
+	pthread_mutex_lock(&clientMutex);
+	unsigned int count(clients.size());
+	pthread_mutex_unlock(&clientMutex);
 
 	return count;
 }
+
+//==========================================================================
+// Class:			LinuxSocket
+// Function:		GetSendStatistics
+//
+// Description:		Returns the outbound queue statistics (TCP servers only).
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		SendStatistics
+//
+//==========================================================================
+LinuxSocket::SendStatistics LinuxSocket::GetSendStatistics(void) const
+{
+	assert(type == SocketTCPServer);
+
+	pthread_mutex_lock(&clientMutex);
+	SendStatistics statistics(sendStatistics);
+	pthread_mutex_unlock(&clientMutex);
+
+	return statistics;
+}
@@ -13,11 +13,9 @@
 // Standard C++ headers
 #include <string>
 #include <vector>
+#include <map>
 #include <iostream>
 
-// *nix headers
-#include <sys/select.h>
-
 // *nix forward declarations
 struct sockaddr_in;
 
@@ -41,6 +39,16 @@ public:
 
 	int Receive(void);
 
+	// TCP servers may instead process messages in the listener thread as they
+	// arrive (handler must be set prior to calling Create()).  When a handler
+	// is in use, Receive() and GetLastMessage() are not used.  The incomming
+	// stream is split into newline-delimited frames; the handler is called once
+	// per frame with the delimiter replaced by '\0' (size excludes the
+	// terminator).  The buffer is only valid for the duration of the call, and
+	// the handler may modify it in place.
+	typedef void (*MessageHandler)(void *context, unsigned char *buffer, const int &size);
+	void SetMessageHandler(MessageHandler handler, void *context);
+
 	// NOTE:  If type == SocketTCPServer, calling method MUST aquire and release mutex when using GetLastMessage
 	const unsigned char *GetLastMessage() { clientMessageSize = 0; return rcvBuffer; };
 
@@ -56,13 +64,28 @@ public:
 
 	unsigned int GetClientCount(void) const;
 
+	// For TCP servers, TCPSend() only queues the message for each client; the
+	// listener thread performs the actual (non-blocking) sends.  Clients that
+	// fall more than sendQueueSize bytes behind are disconnected.
+	struct SendStatistics
+	{
+		unsigned long bytesQueued;
+		unsigned long bytesDropped;
+		unsigned int clientsDropped;
+	};
+
+	SendStatistics GetSendStatistics(void) const;
+
 	static const int SOCKET_ERROR = -1;
 
 	static const unsigned int maxMessageSize;
+	static const unsigned int maxFrameSize;
+	static const unsigned int sendQueueSize;
+	static const char frameDelimiter;
 
 private:
 	static const unsigned int maxConnections;
-	static const unsigned int selectTimeout;// [sec]
+	static const unsigned int maxEvents;
 
 	const SocketType type;
 	std::ostream &outStream;
@@ -70,10 +93,14 @@ private:
 	unsigned char *rcvBuffer;
 	int sock;
 
+	MessageHandler messageHandler;
+	void *handlerContext;
+
 	bool Bind(const sockaddr_in &address);
 	bool Listen(void);
 	bool Connect(const sockaddr_in &address);
 	bool EnableAddressReusue(void);
+	static bool SetBlocking(int fd, bool blocking);
 
 	static std::vector<std::string> GetLocalIPAddress(void);
 	static std::string GetBestLocalIPAddress(const std::string &destination);
@@ -81,21 +108,53 @@ private:
 	static std::string GetTypeString(SocketType type);
 	static std::string GetLastError(void);
 
-	int DoReceive(int sock, struct sockaddr_in *senderAddr = NULL);
+	int DoReceive(int sock, struct sockaddr_in *senderAddr = NULL, int flags = 0);
 	bool TCPServerSend(const void *buffer, const int &bufferSize);
 
 	// TCP server methods and members
 	friend void *LaunchThread(void *pThisSocket);
 	void ListenThreadEntry(void);
-	void HandleClient(int newSock);
+	bool AddToEventLoop(int fd, bool monitorWrite = false);
+	void AcceptConnections(void);
+	bool HandleClient(int clientSock);
+	void DisconnectClient(int clientSock);
+	void DisconnectLaggingClients(void);
+
+	// Per-client stream reassembly (listener thread only)
+	struct FrameBuffer
+	{
+		std::vector<unsigned char> data;
+		unsigned int used;
+	};
+
+	std::map<int, FrameBuffer> frameBuffers;
+	int ReceiveFrames(int clientSock, FrameBuffer &frameBuffer);
+	void DispatchFrames(FrameBuffer &frameBuffer, const unsigned int &scanStart);
+
+	// Per-client outbound ring buffer (protected by clientMutex)
+	struct SendQueue
+	{
+		std::vector<unsigned char> data;
+		unsigned int head;
+		unsigned int count;
+		bool disconnectPending;
+	};
+
+	bool Enqueue(SendQueue &queue, const unsigned char *buffer, const unsigned int &size);
+	bool Flush(int clientSock, SendQueue &queue);
+	void FlushAll(void);
+	void WakeListenThread(void);
 
 	volatile bool continueListening;
 	volatile int clientMessageSize;
+	bool listenerRunning;
 	pthread_t listenerThread;
 	pthread_mutex_t bufferMutex;
-	fd_set clients;
-	fd_set readSocks;
-	int maxSock;
+	mutable pthread_mutex_t clientMutex;
+	std::map<int, SendQueue> clients;
+	SendStatistics sendStatistics;
+	int epollFD;
+	int wakeFD;// eventfd used to interrupt epoll_wait()
 };
 
 #endif// LINUX_SOCKET_H_
@@ -0,0 +1,193 @@
+// File:  loopStatistics.cpp
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Copy:  (c) Copyright 2026
+// Desc:  Control loop health statistics, kept separately for each state.  For
+//        each iteration of the loop, the period (start to start), the time
+//        spent doing work and whether or not the work overran the desired
+//        period are recorded.  All memory is allocated by the constructor.
+//        Not thread-safe - samples must be added, read and reset from the same
+//        thread (for us, this is the control loop thread, so no locks are
+//        required).
+
+// Standard C++ headers
+#include <cassert>
+
+// Local headers
+#include "loopStatistics.h"
+
+//==========================================================================
+// Class:			LoopStatistics
+// Function:		LoopStatistics
+//
+// Description:		Constructor for LoopStatistics class.
+//
+// Input Arguments:
+//		stateCount	= const unsigned int&, number of states for which
+//					  statistics are kept
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+LoopStatistics::LoopStatistics(const unsigned int &stateCount)
+	: stateCount(stateCount)
+{
+	statistics = new StateStatistics[stateCount];
+	Reset();
+}
+
+//==========================================================================
+// Class:			LoopStatistics
+// Function:		~LoopStatistics
+//
+// Description:		Destructor for LoopStatistics class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+LoopStatistics::~LoopStatistics()
+{
+	delete [] statistics;
+}
+
+//==========================================================================
+// Class:			LoopStatistics
+// Function:		Reset
+//
+// Description:		Discards all samples for all states.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void LoopStatistics::Reset(void)
+{
+	unsigned int i;
+	for (i = 0; i < stateCount; i++)
+	{
+		statistics[i].period.Reset();
+		statistics[i].workTime.Reset();
+		statistics[i].overrunCount = 0;
+	}
+}
+
+//==========================================================================
+// Class:			LoopStatistics
+// Function:		AddPeriod
+//
+// Description:		Records the time between the start of the previous
+//					iteration and the start of this one.
+//
+// Input Arguments:
+//		state	= const unsigned int&
+//		period	= const double& [sec]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void LoopStatistics::AddPeriod(const unsigned int &state, const double &period)
+{
+	assert(state < stateCount);
+	statistics[state].period.Add(period);
+}
+
+//==========================================================================
+// Class:			LoopStatistics
+// Function:		AddWorkTime
+//
+// Description:		Records the time spent doing work during one iteration.
+//					If the work took longer than the desired loop period, the
+//					iteration is counted as an overrun.
+//
+// Input Arguments:
+//		state			= const unsigned int&
+//		workTime		= const double& [sec]
+//		desiredPeriod	= const double& [sec]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void LoopStatistics::AddWorkTime(const unsigned int &state,
+	const double &workTime, const double &desiredPeriod)
+{
+	assert(state < stateCount);
+	statistics[state].workTime.Add(workTime);
+	if (workTime > desiredPeriod)
+		statistics[state].overrunCount++;
+}
+
+//==========================================================================
+// Class:			LoopStatistics
+// Function:		Get
+//
+// Description:		Returns the statistics for the specified state.
+//
+// Input Arguments:
+//		state	= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		const StateStatistics&
+//
+//==========================================================================
+const LoopStatistics::StateStatistics& LoopStatistics::Get(
+	const unsigned int &state) const
+{
+	assert(state < stateCount);
+	return statistics[state];
+}
+
+//==========================================================================
+// Class:			LoopStatistics
+// Function:		Print
+//
+// Description:		Writes the statistics for the specified state to the
+//					stream.
+//
+// Input Arguments:
+//		stream	= std::ostream&
+//		state	= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void LoopStatistics::Print(std::ostream &stream, const unsigned int &state) const
+{
+	assert(state < stateCount);
+	stream << " Period:" << std::endl;
+	statistics[state].period.Print(stream);
+	stream << " Work time (" << statistics[state].overrunCount
+		<< " overruns):" << std::endl;
+	statistics[state].workTime.Print(stream);
+}
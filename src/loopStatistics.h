@@ -0,0 +1,54 @@
+// File:  loopStatistics.h
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Copy:  (c) Copyright 2026
+// Desc:  Control loop health statistics, kept separately for each state.  For
+//        each iteration of the loop, the period (start to start), the time
+//        spent doing work and whether or not the work overran the desired
+//        period are recorded.  All memory is allocated by the constructor.
+//        Not thread-safe - samples must be added, read and reset from the same
+//        thread (for us, this is the control loop thread, so no locks are
+//        required).
+
+#ifndef LOOP_STATISTICS_H_
+#define LOOP_STATISTICS_H_
+
+// Standard C++ headers
+#include <ostream>
+
+// Local headers
+#include "timingHistogram.h"
+
+class LoopStatistics
+{
+public:
+	explicit LoopStatistics(const unsigned int &stateCount);
+	~LoopStatistics();
+
+	struct StateStatistics
+	{
+		TimingHistogram period;
+		TimingHistogram workTime;
+		unsigned long overrunCount;
+	};
+
+	void Reset(void);
+	void AddPeriod(const unsigned int &state, const double &period);
+	void AddWorkTime(const unsigned int &state, const double &workTime,
+		const double &desiredPeriod);
+
+	unsigned int GetStateCount(void) const { return stateCount; };
+	const StateStatistics& Get(const unsigned int &state) const;
+
+	void Print(std::ostream &stream, const unsigned int &state) const;
+
+private:
+	const unsigned int stateCount;
+	StateStatistics *statistics;
+
+	// Not copyable
+	LoopStatistics(const LoopStatistics &);
+	LoopStatistics& operator=(const LoopStatistics &);
+};
+
+#endif// LOOP_STATISTICS_H_
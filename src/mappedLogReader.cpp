@@ -0,0 +1,423 @@
+// File:  mappedLogReader.cpp
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Copy:  (c) Copyright 2026
+// Desc:  Fast reader for text time history logs (e.g. the auto-tune log, or
+//        cooking logs recorded before the binary format was introduced).  The
+//        file is memory-mapped and the numbers are parsed in place, without
+//        copying lines or using streams.  Column storage is reserved before
+//        parsing (from the number of lines), and columns are returned as
+//        DataSpans that refer to the reader's storage.  Values may be
+//        separated by commas and/or whitespace.
+
+// Standard C++ headers
+#include <cstring>
+#include <cerrno>
+
+// *nix headers
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+// Local headers
+#include "mappedLogReader.h"
+
+//==========================================================================
+// Class:			MappedLogReader
+// Function:		Constant definitions
+//
+// Description:		Constant definitions for MappedLogReader class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+const unsigned int MappedLogReader::maxExactPowerOfTen(22);
+const double MappedLogReader::powersOfTen[] = { 1.0e0, 1.0e1, 1.0e2, 1.0e3,
+	1.0e4, 1.0e5, 1.0e6, 1.0e7, 1.0e8, 1.0e9, 1.0e10, 1.0e11, 1.0e12, 1.0e13,
+	1.0e14, 1.0e15, 1.0e16, 1.0e17, 1.0e18, 1.0e19, 1.0e20, 1.0e21, 1.0e22 };
+
+//==========================================================================
+// Class:			MappedLogReader
+// Function:		MappedLogReader
+//
+// Description:		Constructor for MappedLogReader class.
+//
+// Input Arguments:
+//		outStream	= std::ostream&, for error messages
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+MappedLogReader::MappedLogReader(std::ostream &outStream) : outStream(outStream)
+{
+}
+
+//==========================================================================
+// Class:			MappedLogReader
+// Function:		GetRowCount
+//
+// Description:		Returns the number of rows that were read.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		unsigned int
+//
+//==========================================================================
+unsigned int MappedLogReader::GetRowCount(void) const
+{
+	if (columns.empty())
+		return 0;
+	return columns.front().size();
+}
+
+//==========================================================================
+// Class:			MappedLogReader
+// Function:		Read
+//
+// Description:		Reads the specified file, replacing any previously read
+//					data.  Columns beyond columnCount are ignored.
+//
+// Input Arguments:
+//		fileName	= const std::string&
+//		columnCount	= const unsigned int&, number of columns to read
+//		headerLines	= const unsigned int&, number of lines to skip (e.g.
+//					  column names and units)
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool MappedLogReader::Read(const std::string &fileName,
+	const unsigned int &columnCount, const unsigned int &headerLines)
+{
+	columns.clear();
+	columns.resize(columnCount);
+
+	int fd(open(fileName.c_str(), O_RDONLY));
+	if (fd == -1)
+	{
+		outStream << "Failed to open '" << fileName << "' for input:  "
+			<< strerror(errno) << std::endl;
+		return false;
+	}
+
+	struct stat info;
+	if (fstat(fd, &info) == -1 || info.st_size == 0)
+	{
+		outStream << "'" << fileName << "' is empty" << std::endl;
+		close(fd);
+		return false;
+	}
+
+	const size_t size(info.st_size);
+	void *mapping(mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0));
+	close(fd);// The mapping remains valid
+	if (mapping == MAP_FAILED)
+	{
+		outStream << "Failed to map '" << fileName << "':  "
+			<< strerror(errno) << std::endl;
+		return false;
+	}
+
+	// The file is read once, from start to end
+	madvise(mapping, size, MADV_SEQUENTIAL);
+
+	const char *start(static_cast<const char*>(mapping));
+	const bool success(Parse(start, start + size, headerLines, fileName));
+	munmap(mapping, size);
+
+	return success;
+}
+
+//==========================================================================
+// Class:			MappedLogReader
+// Function:		Parse
+//
+// Description:		Parses the file contents into the columns.
+//
+// Input Arguments:
+//		start		= const char*, first character in the file
+//		end			= const char*, one past the last character in the file
+//		headerLines	= const unsigned int&
+//		fileName	= const std::string&, for error messages
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool MappedLogReader::Parse(const char *start, const char *end,
+	const unsigned int &headerLines, const std::string &fileName)
+{
+	const char *p(start);
+	unsigned int line;
+	for (line = 0; line < headerLines && p < end; line++)
+	{
+		p = static_cast<const char*>(memchr(p, '\n', end - p));
+		if (!p)
+			p = end;
+		else
+			p++;
+	}
+
+	const unsigned int expectedRows(CountLines(p, end));
+	unsigned int i;
+	for (i = 0; i < columns.size(); i++)
+		columns[i].reserve(expectedRows);
+
+	while (true)
+	{
+		// Skip leading whitespace and blank lines
+		while (p < end && (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n'))
+		{
+			if (*p == '\n')
+				line++;
+			p++;
+		}
+
+		if (p == end)
+			break;
+
+		double value;
+		for (i = 0; i < columns.size(); i++)
+		{
+			if (i > 0)
+			{
+				while (p < end && (*p == ' ' || *p == '\t'))
+					p++;
+				if (p < end && *p == ',')
+					p++;
+				while (p < end && (*p == ' ' || *p == '\t'))
+					p++;
+			}
+
+			if (!ParseNumber(p, end, value))
+			{
+				outStream << "Failed to read column " << i + 1 << " on line "
+					<< line + 1 << " of '" << fileName << "'" << std::endl;
+				return false;
+			}
+
+			columns[i].push_back(value);
+		}
+
+		// Ignore the remainder of the line
+		p = static_cast<const char*>(memchr(p, '\n', end - p));
+		if (!p)
+			break;
+	}
+
+	return true;
+}
+
+//==========================================================================
+// Class:			MappedLogReader
+// Function:		CountLines
+//
+// Description:		Counts the lines in the specified range (including a last
+//					line that does not end with a newline).
+//
+// Input Arguments:
+//		start	= const char*
+//		end		= const char*
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		unsigned int
+//
+//==========================================================================
+unsigned int MappedLogReader::CountLines(const char *start, const char *end)
+{
+	unsigned int count(0);
+	const char *p(start);
+	while (p < end)
+	{
+		p = static_cast<const char*>(memchr(p, '\n', end - p));
+		count++;
+		if (!p)
+			break;
+		p++;
+	}
+
+	return count;
+}
+
+//==========================================================================
+// Class:			MappedLogReader
+// Function:		ParseNumber
+//
+// Description:		Parses a decimal floating point number.  Up to 18
+//					significant digits are accumulated as integers, so the
+//					result is within an ulp or so of strtod() (which is much
+//					slower, and depends on the locale).
+//
+// Input Arguments:
+//		p	= const char*&, first character of the number
+//		end	= const char*, one past the last character that may be read
+//
+// Output Arguments:
+//		p		= const char*&, first character following the number
+//		value	= double&
+//
+// Return Value:
+//		bool, true for success, false if p does not point to a number
+//
+//==========================================================================
+bool MappedLogReader::ParseNumber(const char *&p, const char *end, double &value)
+{
+	const char *s(p);
+	bool negative(false);
+	if (s < end && (*s == '-' || *s == '+'))
+	{
+		negative = *s == '-';
+		s++;
+	}
+
+	// Significant digits are split in two so that each part fits in 32 bits
+	unsigned long high(0), low(0);
+	unsigned int digits(0);
+	int exponent(0);
+	bool foundDigit(false), fraction(false);
+	for (; s < end; s++)
+	{
+		if (*s == '.' && !fraction)
+		{
+			fraction = true;
+			continue;
+		}
+		else if (*s < '0' || *s > '9')
+			break;
+
+		const unsigned int digit(*s - '0');
+		foundDigit = true;
+		if (digits == 0 && digit == 0)
+		{
+			// Leading zero
+			if (fraction)
+				exponent--;
+		}
+		else if (digits < 18)
+		{
+			if (digits < 9)
+				high = high * 10 + digit;
+			else
+				low = low * 10 + digit;
+			digits++;
+
+			if (fraction)
+				exponent--;
+		}
+		else if (!fraction)// Digits beyond the ones we keep
+			exponent++;
+	}
+
+	if (!foundDigit)
+		return false;
+
+	if (s < end && (*s == 'e' || *s == 'E'))
+	{
+		const char *e(s + 1);
+		bool negativeExponent(false);
+		if (e < end && (*e == '-' || *e == '+'))
+		{
+			negativeExponent = *e == '-';
+			e++;
+		}
+
+		if (e < end && *e >= '0' && *e <= '9')
+		{
+			int explicitExponent(0);
+			for (; e < end && *e >= '0' && *e <= '9'; e++)
+			{
+				if (explicitExponent < 10000)
+					explicitExponent = explicitExponent * 10 + *e - '0';
+			}
+
+			if (negativeExponent)
+				exponent -= explicitExponent;
+			else
+				exponent += explicitExponent;
+			s = e;
+		}
+		// Otherwise, the 'e' is not part of this number
+	}
+
+	if (digits <= 9)
+		value = static_cast<double>(high);
+	else
+		value = high * powersOfTen[digits - 9] + low;
+
+	value = ScaleByPowerOfTen(value, exponent);
+	if (negative)
+		value = -value;
+
+	p = s;
+	return true;
+}
+
+//==========================================================================
+// Class:			MappedLogReader
+// Function:		ScaleByPowerOfTen
+//
+// Description:		Returns value * 10^exponent.  Powers up to 10^22 are exact
+//					doubles, so typical values need only one rounding step.
+//
+// Input Arguments:
+//		value		= double
+//		exponent	= int
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		double
+//
+//==========================================================================
+double MappedLogReader::ScaleByPowerOfTen(double value, int exponent)
+{
+	if (value == 0.0)
+		return value;
+
+	while (exponent > static_cast<int>(maxExactPowerOfTen))
+	{
+		value *= powersOfTen[maxExactPowerOfTen];
+		exponent -= maxExactPowerOfTen;
+	}
+
+	while (exponent < -static_cast<int>(maxExactPowerOfTen))
+	{
+		value /= powersOfTen[maxExactPowerOfTen];
+		exponent += maxExactPowerOfTen;
+	}
+
+	if (exponent > 0)
+		return value * powersOfTen[exponent];
+	else if (exponent < 0)
+		return value / powersOfTen[-exponent];
+
+	return value;
+}
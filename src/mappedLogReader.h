@@ -0,0 +1,54 @@
+// File:  mappedLogReader.h
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Copy:  (c) Copyright 2026
+// Desc:  Fast reader for text time history logs (e.g. the auto-tune log, or
+//        cooking logs recorded before the binary format was introduced).  The
+//        file is memory-mapped and the numbers are parsed in place, without
+//        copying lines or using streams.  Column storage is reserved before
+//        parsing (from the number of lines), and columns are returned as
+//        DataSpans that refer to the reader's storage.  Values may be
+//        separated by commas and/or whitespace.
+
+#ifndef MAPPED_LOG_READER_H_
+#define MAPPED_LOG_READER_H_
+
+// Standard C++ headers
+#include <string>
+#include <vector>
+#include <iostream>
+
+// Local headers
+#include "dataSpan.h"
+
+class MappedLogReader
+{
+public:
+	explicit MappedLogReader(std::ostream &outStream = std::cout);
+
+	bool Read(const std::string &fileName, const unsigned int &columnCount,
+		const unsigned int &headerLines = 2);
+
+	unsigned int GetColumnCount(void) const { return columns.size(); };
+	unsigned int GetRowCount(void) const;
+	DataSpan GetColumn(const unsigned int &i) const { return DataSpan(columns[i]); };
+
+	// Parses a number (optionally signed, with optional fraction and
+	// exponent) starting at p; on success, p is moved past the number
+	static bool ParseNumber(const char *&p, const char *end, double &value);
+
+private:
+	static const unsigned int maxExactPowerOfTen;
+	static const double powersOfTen[];
+
+	std::ostream &outStream;
+
+	std::vector<std::vector<double> > columns;
+
+	bool Parse(const char *start, const char *end, const unsigned int &headerLines,
+		const std::string &fileName);
+	static unsigned int CountLines(const char *start, const char *end);
+	static double ScaleByPowerOfTen(double value, int exponent);
+};
+
+#endif// MAPPED_LOG_READER_H_
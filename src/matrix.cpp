@@ -9,9 +9,12 @@
 #include <cstdarg>
 #include <cmath>
 #include <cassert>
+#include <cstring>
+#include <algorithm>
 
 // Local headers
 #include "matrix.h"
+#include "vectorKernels.h"
 
 //==========================================================================
 // Class:			Matrix
@@ -30,6 +33,7 @@
 //
 //==========================================================================
 const double Matrix::nearlyZero = 1.0e-15;
+const double Matrix::rankTolerance = 1.0e-12;
 
 //==========================================================================
 // Class:			Matrix
@@ -113,7 +117,7 @@ Matrix::Matrix(const unsigned int &_rows, const unsigned int &_columns, double e
 	va_list argumentList;
 	va_start(argumentList, element1);
 
-	elements[0][0] = element1;
+	elements[0] = element1;
 
 	// Fill all of the elements with the arguments
 	// NOTE:  There is no check to make sure the correct number of elements was
@@ -124,7 +128,7 @@ Matrix::Matrix(const unsigned int &_rows, const unsigned int &_columns, double e
 		for (j = 0; j < columns; j++)
 		{
 			if (i != 0 || j != 0)// Already assigned element [0][0]
-				elements[i][j] = va_arg(argumentList, double);
+				elements[i * columns + j] = va_arg(argumentList, double);
 		}
 	}
 
@@ -200,7 +204,7 @@ void Matrix::SetElement(const unsigned int &row, const unsigned int &column, con
 {
 	assert(row < rows && column < columns);
 
-	elements[row][column] = value;
+	elements[row * columns + column] = value;
 }
 
 //==========================================================================
@@ -228,7 +232,7 @@ void Matrix::Set(double element1, ...)
 	va_list argumentList;
 	va_start(argumentList, element1);
 
-	elements[0][0] = element1;
+	elements[0] = element1;
 
 	// Fill all of the elements with the arguments
 	// NOTE:  There is no check to make sure the correct number of elements was
@@ -239,7 +243,7 @@ void Matrix::Set(double element1, ...)
 		for (j = 0; j < columns; j++)
 		{
 			if (i != 0 || j != 0)// Already assigned element [0][0]
-				elements[i][j] = va_arg(argumentList, double);
+				elements[i * columns + j] = va_arg(argumentList, double);
 		}
 	}
 
@@ -265,7 +269,7 @@ void Matrix::Set(double element1, ...)
 //==========================================================================
 double Matrix::GetElement(const int &row, const int &column) const
 {
-	return elements[row][column];
+	return elements[row * columns + column];
 }
 
 //==========================================================================
@@ -290,7 +294,7 @@ Matrix& Matrix::MakeIdentity(void)
 
 	unsigned int i;
 	for (i = 0; i < GetMinimumDimension(); i++)
-		elements[i][i] = 1.0;
+		elements[i * columns + i] = 1.0;
 
 	return *this;
 }
@@ -313,12 +317,10 @@ Matrix& Matrix::MakeIdentity(void)
 //==========================================================================
 void Matrix::Zero(void)
 {
-	unsigned int i, j;
-	for (i = 0; i < rows; i++)
-	{
-		for (j = 0; j < columns; j++)
-			elements[i][j] = 0.0;
-	}
+	const unsigned int count(rows * columns);
+	unsigned int i;
+	for (i = 0; i < count; i++)
+		elements[i] = 0.0;
 }
 
 //==========================================================================
@@ -352,7 +354,7 @@ Matrix Matrix::GetSubMatrix(const unsigned int &startRow, const unsigned int &st
 	for (i = 0; i < subRows; i++)
 	{
 		for (j = 0; j < subColumns; j++)
-			subMatrix.elements[i][j] = elements[i + startRow][j + startColumn];
+			subMatrix.elements[i * subMatrix.columns + j] = elements[(i + startRow) * columns + j + startColumn];
 	}
 
 	return subMatrix;
@@ -383,7 +385,7 @@ Matrix Matrix::GetTranspose(void) const
 	for (i = 0; i < rows; i++)
 	{
 		for (j = 0; j < columns; j++)
-			transpose.elements[j][i] = elements[i][j];
+			transpose.elements[j * transpose.columns + i] = elements[i * columns + j];
 	}
 
 	return transpose;
@@ -395,7 +397,9 @@ Matrix Matrix::GetTranspose(void) const
 //
 // Description:		Performs division from the left.  For example, to solve
 //					Ax=b for x, left divide x = A \ b, where this matrix is A.
-//					Same as A^-1 * b.
+//					Same as A^-1 * b.  The product V * W^-1 * U^T * b is
+//					evaluated right-to-left, one vector at a time, so no
+//					matrix-sized temporaries are created.
 //
 // Input Arguments:
 //		b	= const Matrix& vector to divide this into
@@ -420,7 +424,255 @@ bool Matrix::LeftDivide(const Matrix &b, Matrix &x) const
 	if (!GetSingularValueDecomposition(U, V, W))
 		return false;
 
-	x = V * W.GetDiagonalInverse().GetTranspose() * U.GetTranspose() * b;
+	Matrix y;
+	TransposeMultiply(U, b, y);
+
+	// W is square and diagonal
+	unsigned int i, j;
+	for (i = 0; i < y.rows; i++)
+	{
+		const double w(W.elements[i * W.columns + i]);
+		for (j = 0; j < y.columns; j++)
+		{
+			if (IsZero(w))
+				y.elements[i * y.columns + j] = 0.0;
+			else
+				y.elements[i * y.columns + j] /= w;
+		}
+	}
+
+	Multiply(V, y, x);
+	return true;
+}
+
+//==========================================================================
+// Class:			Matrix
+// Function:		SolveLeastSquaresQR
+//
+// Description:		Solves Ax=b in the least-squares sense (this matrix is A)
+//					using a QR factorization built with Givens rotations.  The
+//					rows of A and b are read one at a time and rotated into
+//					the (columns x columns) R factor and the first columns
+//					rows of Q^T * b, so the additional memory is
+//					O(columns * (columns + b columns)), independent of the
+//					number of rows.  The cost is O(rows * columns^2) instead
+//					of the O(rows^2) of the full SVD.  b may have more than
+//					one column.  A must have full column rank.
+//
+// Input Arguments:
+//		b	= const Matrix&
+//
+// Output Arguments:
+//		x	= Matrix&
+//
+// Return Value:
+//		bool, true for success, false if A is rank deficient
+//
+//==========================================================================
+bool Matrix::SolveLeastSquaresQR(const Matrix &b, Matrix &x) const
+{
+	assert(b.rows == rows);
+	if (rows < columns || columns == 0)
+		return false;
+
+	// Each row of Ry is a row of R followed by the same row of Q^T * b; rows
+	// with a zero diagonal have not been reached by any rotation yet
+	const unsigned int width(columns + b.columns);
+	Matrix Ry(columns, width);
+	double *work(new double[width]);
+
+	unsigned int i, j, k;
+	for (i = 0; i < rows; i++)
+	{
+		for (k = 0; k < columns; k++)
+			work[k] = elements[i * columns + k];
+		for (k = 0; k < b.columns; k++)
+			work[columns + k] = b.elements[i * b.columns + k];
+
+		// Rotate the new row against each row of R to zero it
+		for (j = 0; j < columns; j++)
+		{
+			if (work[j] == 0.0)
+				continue;
+
+			double *r(Ry.elements + j * width);
+			if (r[j] == 0.0)
+			{
+				for (k = j; k < width; k++)
+					r[k] = work[k];
+				break;
+			}
+
+			// Scaled to avoid overflow in the norm
+			double c, sn;
+			if (fabs(work[j]) > fabs(r[j]))
+			{
+				const double t(r[j] / work[j]);
+				sn = 1.0 / sqrt(1.0 + t * t);
+				c = sn * t;
+			}
+			else
+			{
+				const double t(work[j] / r[j]);
+				c = 1.0 / sqrt(1.0 + t * t);
+				sn = c * t;
+			}
+
+			for (k = j; k < width; k++)
+			{
+				const double rk(r[k]);
+				r[k] = c * rk + sn * work[k];
+				work[k] = c * work[k] - sn * rk;
+			}
+		}
+	}
+
+	delete [] work;
+
+	double maxDiagonal(0.0);
+	for (j = 0; j < columns; j++)
+	{
+		if (fabs(Ry.elements[j * width + j]) > maxDiagonal)
+			maxDiagonal = fabs(Ry.elements[j * width + j]);
+	}
+
+	for (j = 0; j < columns; j++)
+	{
+		if (fabs(Ry.elements[j * width + j]) <= rankTolerance * maxDiagonal ||
+			maxDiagonal == 0.0)
+			return false;
+	}
+
+	// Back substitution with the upper triangle of R
+	x.Resize(columns, b.columns);
+	int row;
+	for (k = 0; k < b.columns; k++)
+	{
+		for (row = columns - 1; row >= 0; row--)
+		{
+			const double *r(Ry.elements + row * width);
+			double sum(r[columns + k]);
+			for (j = row + 1; j < columns; j++)
+				sum -= r[j] * x.elements[j * x.columns + k];
+			x.elements[row * x.columns + k] = sum / r[row];
+		}
+	}
+
+	return true;
+}
+
+//==========================================================================
+// Class:			Matrix
+// Function:		SolveLeastSquaresCholesky
+//
+// Description:		Solves Ax=b in the least-squares sense (this matrix is A)
+//					using the normal equations, A^T * A * x = A^T * b, and a
+//					Cholesky factorization.  This is the fastest method and
+//					needs only O(columns^2) additional memory, but the
+//					normal equations square the condition number of A.  The
+//					columns are scaled to unit norm and the solution is
+//					refused if the estimated reciprocal condition number of
+//					the scaled A^T * A is below the specified limit (use
+//					SolveLeastSquaresQR() in that case).
+//
+// Input Arguments:
+//		b							= const Matrix&
+//		minimumReciprocalCondition	= const double&
+//
+// Output Arguments:
+//		x	= Matrix&
+//
+// Return Value:
+//		bool, true for success, false if A^T * A is too poorly conditioned
+//
+//==========================================================================
+bool Matrix::SolveLeastSquaresCholesky(const Matrix &b, Matrix &x,
+	const double &minimumReciprocalCondition) const
+{
+	assert(b.rows == rows);
+	if (rows < columns || columns == 0)
+		return false;
+
+	Matrix G, c;
+	TransposeMultiply(*this, *this, G);
+	TransposeMultiply(*this, b, c);
+
+	unsigned int i, j, k;
+	double *scale(new double[columns]);
+	for (i = 0; i < columns; i++)
+	{
+		if (!(G.elements[i * columns + i] > 0.0))
+		{
+			delete [] scale;
+			return false;
+		}
+		scale[i] = 1.0 / sqrt(G.elements[i * columns + i]);
+	}
+
+	// Factor the scaled matrix in place (lower triangle holds L)
+	double minPivot(1.0), maxPivot(0.0);
+	for (j = 0; j < columns; j++)
+	{
+		double pivot(G.elements[j * columns + j] * scale[j] * scale[j]);
+		for (k = 0; k < j; k++)
+			pivot -= G.elements[j * columns + k] * G.elements[j * columns + k];
+
+		if (!(pivot > 0.0))
+		{
+			delete [] scale;
+			return false;
+		}
+
+		pivot = sqrt(pivot);
+		G.elements[j * columns + j] = pivot;
+		if (pivot < minPivot)
+			minPivot = pivot;
+		if (pivot > maxPivot)
+			maxPivot = pivot;
+
+		for (i = j + 1; i < columns; i++)
+		{
+			double sum(G.elements[i * columns + j] * scale[i] * scale[j]);
+			for (k = 0; k < j; k++)
+				sum -= G.elements[i * columns + k] * G.elements[j * columns + k];
+			G.elements[i * columns + j] = sum / pivot;
+		}
+	}
+
+	const double ratio(minPivot / maxPivot);
+	if (ratio * ratio < minimumReciprocalCondition)
+	{
+		delete [] scale;
+		return false;
+	}
+
+	// Solve L * z = c, then L^T * w = z, then undo the scaling
+	x.Resize(columns, c.columns);
+	int row;
+	for (k = 0; k < c.columns; k++)
+	{
+		for (i = 0; i < columns; i++)
+		{
+			double sum(c.elements[i * c.columns + k] * scale[i]);
+			for (j = 0; j < i; j++)
+				sum -= G.elements[i * columns + j] * x.elements[j * x.columns + k];
+			x.elements[i * x.columns + k] = sum / G.elements[i * columns + i];
+		}
+
+		for (row = columns - 1; row >= 0; row--)
+		{
+			double sum(x.elements[row * x.columns + k]);
+			for (j = row + 1; j < columns; j++)
+				sum -= G.elements[j * columns + row] * x.elements[j * x.columns + k];
+			x.elements[row * x.columns + k] = sum / G.elements[row * columns + row];
+		}
+
+		for (i = 0; i < columns; i++)
+			x.elements[i * x.columns + k] *= scale[i];
+	}
+
+	delete [] scale;
+
 	return true;
 }
 
@@ -442,24 +694,127 @@ bool Matrix::LeftDivide(const Matrix &b, Matrix &x) const
 //==========================================================================
 Matrix& Matrix::operator *= (const Matrix &target)
 {
-	assert(columns == target.rows);
+	Matrix result;
+	Multiply(*this, target, result);
+	Swap(result);
 
-	Matrix result(rows, target.columns);
+	return *this;
+}
 
-	unsigned int counter, i, j;
+//==========================================================================
+// Class:			Matrix
+// Function:		Multiply
+//
+// Description:		Computes result = left * right.  result is resized as
+//					required (memory is reused if it is already the right
+//					size) and must not be the same object as either operand.
+//
+// Input Arguments:
+//		left	= const Matrix&
+//		right	= const Matrix&
+//
+// Output Arguments:
+//		result	= Matrix&
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void Matrix::Multiply(const Matrix &left, const Matrix &right, Matrix &result)
+{
+	assert(left.columns == right.rows);
+	assert(&result != &left && &result != &right);
+
+	result.Resize(left.rows, right.columns);
+
+	unsigned int counter, i;
+	if (right.columns == 1)
+	{
+		// Matrix-vector product:  one dot product per row
+		for (i = 0; i < result.rows; i++)
+			result.elements[i] = VectorKernels::Dot(
+				left.elements + i * left.columns, right.elements, left.columns);
+		return;
+	}
+
+	result.Zero();
+
+	// Ordered so the inner loop runs along rows of both result and right
 	for (i = 0; i < result.rows; i++)
 	{
-		for (j = 0; j < result.columns; j++)
+		double *resultRow(result.elements + i * result.columns);
+		for (counter = 0; counter < left.columns; counter++)
+			VectorKernels::AddScaled(resultRow, right.elements + counter * right.columns,
+				left.elements[i * left.columns + counter], result.columns);
+	}
+}
+
+//==========================================================================
+// Class:			Matrix
+// Function:		TransposeMultiply
+//
+// Description:		Computes result = left^T * right without forming the
+//					transpose.  result is resized as required and must not be
+//					the same object as either operand.
+//
+// Input Arguments:
+//		left	= const Matrix&
+//		right	= const Matrix&
+//
+// Output Arguments:
+//		result	= Matrix&
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void Matrix::TransposeMultiply(const Matrix &left, const Matrix &right,
+	Matrix &result)
+{
+	assert(left.rows == right.rows);
+	assert(&result != &left && &result != &right);
+
+	result.Resize(left.columns, right.columns);
+	result.Zero();
+
+	// Accumulate one outer product per row, so both operands are read in order
+	unsigned int counter, i, j;
+	for (counter = 0; counter < left.rows; counter++)
+	{
+		const double *leftRow(left.elements + counter * left.columns);
+		const double *rightRow(right.elements + counter * right.columns);
+		for (i = 0; i < result.rows; i++)
 		{
-			result.elements[i][j] = 0.0;
-			for (counter = 0; counter < columns; counter++)
-				result.elements[i][j] += elements[i][counter] * target.elements[counter][j];
+			double *resultRow(result.elements + i * result.columns);
+			for (j = 0; j < result.columns; j++)
+				resultRow[j] += leftRow[i] * rightRow[j];
 		}
 	}
+}
 
-	*this = result;
-
-	return *this;
+//==========================================================================
+// Class:			Matrix
+// Function:		Swap
+//
+// Description:		Exchanges the contents of this matrix with the target.
+//					Only pointers and dimensions are exchanged, so this can be
+//					used to hand off a result without copying it.
+//
+// Input Arguments:
+//		target	= Matrix&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void Matrix::Swap(Matrix &target)
+{
+	std::swap(rows, target.rows);
+	std::swap(columns, target.columns);
+	std::swap(elements, target.elements);
 }
 
 //==========================================================================
@@ -484,13 +839,8 @@ Matrix& Matrix::operator = (const Matrix &target)
 		return *this;
 
 	Resize(target.rows, target.columns);
-
-	unsigned int i, j;
-	for (i = 0; i < rows; i++)
-	{
-		for (j = 0; j < columns; j++)
-			elements[i][j] = target.elements[i][j];
-	}
+	if (rows * columns > 0)
+		memcpy(elements, target.elements, rows * columns * sizeof(double));
 
 	return *this;
 }
@@ -515,12 +865,10 @@ Matrix& Matrix::operator += (const Matrix &target)
 {
 	assert(columns == target.columns && rows == target.rows);
 
-	unsigned int i, j;
-	for (i = 0; i < rows; i++)
-	{
-		for (j = 0; j < columns; j++)
-			elements[i][j] += target.elements[i][j];
-	}
+	const unsigned int count(rows * columns);
+	unsigned int i;
+	for (i = 0; i < count; i++)
+		elements[i] += target.elements[i];
 
 	return *this;
 }
@@ -545,12 +893,10 @@ Matrix& Matrix::operator -= (const Matrix &target)
 {
 	assert(columns == target.columns && rows == target.rows);
 
-	unsigned int i, j;
-	for (i = 0; i < rows; i++)
-	{
-		for (j = 0; j < columns; j++)
-			elements[i][j] -= target.elements[i][j];
-	}
+	const unsigned int count(rows * columns);
+	unsigned int i;
+	for (i = 0; i < count; i++)
+		elements[i] -= target.elements[i];
 
 	return *this;
 }
@@ -574,12 +920,10 @@ Matrix& Matrix::operator -= (const Matrix &target)
 //==========================================================================
 Matrix& Matrix::operator *=(const double &target)
 {
-	unsigned int i, j;
-	for (i = 0; i < rows; i++)
-	{
-		for (j = 0; j < columns; j++)
-			elements[i][j] *= target;
-	}
+	const unsigned int count(rows * columns);
+	unsigned int i;
+	for (i = 0; i < count; i++)
+		elements[i] *= target;
 
 	return *this;
 }
@@ -603,12 +947,10 @@ Matrix& Matrix::operator *=(const double &target)
 //==========================================================================
 Matrix& Matrix::operator /=(const double &target)
 {
-	unsigned int i, j;
-	for (i = 0; i < rows; i++)
-	{
-		for (j = 0; j < columns; j++)
-			elements[i][j] /= target;
-	}
+	const unsigned int count(rows * columns);
+	unsigned int i;
+	for (i = 0; i < count; i++)
+		elements[i] /= target;
 
 	return *this;
 }
@@ -637,11 +979,11 @@ Matrix Matrix::GetRowReduced(void) const
 
 	for (pivotRow = 0; pivotRow < GetMinimumDimension(); pivotRow++)
 	{
-		if (!IsZero(reduced.elements[pivotRow][pivotCol]))
+		if (!IsZero(reduced.elements[pivotRow * reduced.columns + pivotCol]))
 		{
 			for (curRow = pivotRow + 1; curRow < rows; curRow++)
 			{
-				if (!IsZero(reduced.elements[curRow][pivotCol]))
+				if (!IsZero(reduced.elements[curRow * reduced.columns + pivotCol]))
 					reduced.ZeroRowByScalingAndAdding(pivotRow, pivotCol, curRow);
 			}
 		}
@@ -649,7 +991,7 @@ Matrix Matrix::GetRowReduced(void) const
 		{
 			for (curRow = pivotRow + 1; curRow < rows; curRow++)
 			{
-				if (!IsZero(reduced.elements[curRow][pivotCol]))
+				if (!IsZero(reduced.elements[curRow * reduced.columns + pivotCol]))
 				{
 					reduced.SwapRows(pivotRow, curRow);
 					pivotCol--;
@@ -691,9 +1033,9 @@ Matrix& Matrix::SwapRows(const unsigned int &r1, const unsigned int &r2)
 	unsigned int i;
 	for (i = 0; i < columns; i++)
 	{
-		swap = elements[r1][i];
-		elements[r1][i] = elements[r2][i];
-		elements[r2][i] = swap;
+		swap = elements[r1 * columns + i];
+		elements[r1 * columns + i] = elements[r2 * columns + i];
+		elements[r2 * columns + i] = swap;
 	}
 
 	return *this;
@@ -721,11 +1063,11 @@ Matrix& Matrix::SwapRows(const unsigned int &r1, const unsigned int &r2)
 void Matrix::ZeroRowByScalingAndAdding(const unsigned int &pivotRow,
 	const unsigned int &pivotColumn, const unsigned int &targetRow)
 {
-	double factor = elements[pivotRow][pivotColumn] / elements[targetRow][pivotColumn];
+	double factor = elements[pivotRow * columns + pivotColumn] / elements[targetRow * columns + pivotColumn];
 
 	unsigned int i;
 	for (i = pivotColumn; i < columns; i++)
-		elements[targetRow][i] = elements[targetRow][i] * factor - elements[pivotRow][i];
+		elements[targetRow * columns + i] = elements[targetRow * columns + i] * factor - elements[pivotRow * columns + i];
 }
 
 //==========================================================================
@@ -747,8 +1089,7 @@ void Matrix::ZeroRowByScalingAndAdding(const unsigned int &pivotRow,
 const Matrix Matrix::operator+(const Matrix &target) const
 {
 	// Create the return matrix
-	Matrix temp(target.rows, target.columns);
-	temp = *this;
+	Matrix temp(*this);
 
 	// Do the addition
 	temp += target;
@@ -775,8 +1116,7 @@ const Matrix Matrix::operator+(const Matrix &target) const
 const Matrix Matrix::operator-(const Matrix &target) const
 {
 	// Create the return matrix
-	Matrix temp(target.rows, target.columns);
-	temp = *this;
+	Matrix temp(*this);
 
 	// Do the subtraction
 	temp -= target;
@@ -802,14 +1142,10 @@ const Matrix Matrix::operator-(const Matrix &target) const
 //==========================================================================
 const Matrix Matrix::operator*(const Matrix &target) const
 {
-	// Create the return matrix
-	Matrix temp(target.rows, target.columns);
-	temp = *this;
-
-	// Do the multiplication
-	temp *= target;
+	Matrix result;
+	Multiply(*this, target, result);
 
-	return temp;
+	return result;
 }
 
 //==========================================================================
@@ -831,8 +1167,7 @@ const Matrix Matrix::operator*(const Matrix &target) const
 const Matrix Matrix::operator * (const double &target) const
 {
 	// Create the return matrix
-	Matrix temp(rows, columns);
-	temp = *this;
+	Matrix temp(*this);
 
 	// Do the multiplication
 	temp *= target;
@@ -859,8 +1194,7 @@ const Matrix Matrix::operator * (const double &target) const
 const Matrix Matrix::operator / (const double &target) const
 {
 	// Create the return matrix
-	Matrix temp(rows, columns);
-	temp = *this;
+	Matrix temp(*this);
 
 	// Do the division
 	temp /= target;
@@ -868,60 +1202,6 @@ const Matrix Matrix::operator / (const double &target) const
 	return temp;
 }
 
-//==========================================================================
-// Class:			Matrix
-// Function:		operator ()
-//
-// Description:		Overload of the () operator for this object.  Permits accessing
-//					class data by using Matrix(row, column).  Non-const version.
-//
-// Input Arguments:
-//		row		= const unsigned int& specifying the row of the desired element (0-based)
-//		column	= const unsigned int& specifying the column of the desired element (0-based)
-//
-// Output Arguments:
-//		None
-//
-// Return Value:
-//		double&, reference to the specified element
-//
-//==========================================================================
-double &Matrix::operator () (const unsigned int &row, const unsigned int &column)
-{
-	// Make sure the indecies are valid
-	assert(row < rows && column < columns);
-
-	// Return the specified element
-	return elements[row][column];
-}
-
-//==========================================================================
-// Class:			Matrix
-// Function:		operator ()
-//
-// Description:		Overload of the () operator for this object.  Permits accessing
-//					class data by using Matrix(Row, Column).  Const version.
-//
-// Input Arguments:
-//		row		= const unsigned int& specifying the row of the desired element (0-based)
-//		column	= const unsigned int& specifying the column of the desired element (0-based)
-//
-// Output Arguments:
-//		None
-//
-// Return Value:
-//		const double&, reference to the specified element
-//
-//==========================================================================
-const double &Matrix::operator () (const unsigned int &row, const unsigned int &column) const
-{
-	// Make sure the indecies are valid
-	assert(row < rows && column < columns);
-
-	// Return the specified element
-	return elements[row][column];
-}
-
 //==========================================================================
 // Class:			Matrix
 // Function:		GetInverse
@@ -975,7 +1255,22 @@ bool Matrix::GetPsuedoInverse(Matrix &inverse) const
 	if (!GetSingularValueDecomposition(U, V, W))
 		return false;
 
-	inverse = V * W.GetDiagonalInverse() * U.GetTranspose();
+	// Scale the columns of V by the inverted singular values, instead of
+	// forming the inverse of W
+	unsigned int i, j;
+	for (j = 0; j < V.columns; j++)
+	{
+		const double w(W.elements[j * W.columns + j]);
+		for (i = 0; i < V.rows; i++)
+		{
+			if (IsZero(w))
+				V.elements[i * V.columns + j] = 0.0;
+			else
+				V.elements[i * V.columns + j] /= w;
+		}
+	}
+
+	Multiply(V, U.GetTranspose(), inverse);
 	return true;
 }
 
@@ -1006,10 +1301,10 @@ Matrix Matrix::GetDiagonalInverse(void) const
 	unsigned int i;
 	for (i = 0; i < inverse.GetMinimumDimension(); i++)
 	{
-		if (IsZero(elements[i][i]))
-			inverse.elements[i][i] = 0.0;
+		if (IsZero(elements[i * columns + i]))
+			inverse.elements[i * inverse.columns + i] = 0.0;
 		else
-			inverse.elements[i][i] = 1.0 / elements[i][i];
+			inverse.elements[i * inverse.columns + i] = 1.0 / elements[i * columns + i];
 	}
 
 	return inverse;
@@ -1070,7 +1365,7 @@ unsigned int Matrix::GetRank(void) const
 	{
 		for (curCol = 0; curCol < columns; curCol++)
 		{
-			if (!IsZero(elements[curRow][curCol]))
+			if (!IsZero(elements[curRow * columns + curCol]))
 			{
 				// Row contained a non-zero element - increment the rank
 				// and stop looking at the other elements in this row
@@ -1101,9 +1396,6 @@ unsigned int Matrix::GetRank(void) const
 //==========================================================================
 void Matrix::FreeElements(void)
 {
-	unsigned int i;
-	for (i = 0; i < rows; i++)
-		delete [] elements[i];
 	delete [] elements;
 	elements = NULL;
 }
@@ -1113,7 +1405,8 @@ void Matrix::FreeElements(void)
 // Function:		AllocateElements
 //
 // Description:		Allocates memory for the elements according to the number
-//					of rows and columns that make up this object.
+//					of rows and columns that make up this object.  Elements
+//					are stored in a single block, in row-major order.
 //
 // Input Arguments:
 //		None
@@ -1127,10 +1420,10 @@ void Matrix::FreeElements(void)
 //==========================================================================
 void Matrix::AllocateElements(void)
 {
-	elements = new double*[rows];
-	unsigned int i;
-	for (i = 0; i < rows; i++)
-		elements[i] = new double[columns];
+	if (rows * columns == 0)
+		elements = NULL;
+	else
+		elements = new double[rows * columns];
 }
 
 //==========================================================================
@@ -1138,7 +1431,9 @@ void Matrix::AllocateElements(void)
 // Function:		Resize
 //
 // Description:		Resizes the dynamic memory for this object to accommodate
-//					the specified size.
+//					the specified size.  If the number of elements does not
+//					change, the existing memory is reused.  Element values are
+//					not preserved in either case.
 //
 // Input Arguments:
 //		_rows		= const unsigned int& specifying new vertical dimension
@@ -1153,6 +1448,13 @@ void Matrix::AllocateElements(void)
 //==========================================================================
 void Matrix::Resize(const unsigned int &_rows, const unsigned int &_columns)
 {
+	if (_rows * _columns == rows * columns)
+	{
+		rows = _rows;
+		columns = _columns;
+		return;
+	}
+
 	FreeElements();
 
 	rows = _rows;
@@ -1233,7 +1535,7 @@ void Matrix::InitializeSVDMatrices(Matrix &U, Matrix &V, Matrix &W) const
 	for (i = 0; i < U.rows; i++)
 	{
 		for (j = 0; j < V.rows; j++)
-			U.elements[i][j] = elements[i][j];
+			U.elements[i * U.columns + j] = elements[i * columns + j];
 	}
 }
 
@@ -1271,40 +1573,40 @@ double Matrix::ReduceToBidiagonalForm(Matrix &U, Matrix &V, Matrix &W, double *r
 		if (i < U.rows)
 		{
 			for (k = i; k < U.rows; k++)
-				scale += fabs(U.elements[k][i]);
+				scale += fabs(U.elements[k * U.columns + i]);
 
 			if (scale != 0.0)
 			{
 				for (k = i; k < U.rows; k++)
 				{
-					U.elements[k][i] /= scale;
-					s += U.elements[k][i] * U.elements[k][i];
+					U.elements[k * U.columns + i] /= scale;
+					s += U.elements[k * U.columns + i] * U.elements[k * U.columns + i];
 				}
 
-				f = U.elements[i][i];
+				f = U.elements[i * U.columns + i];
 				if (f >= 0.0)
 					g = -sqrt(s);
 				else
 					g = sqrt(s);
 
 				h = f * g - s;
-				U.elements[i][i] = f - g;
+				U.elements[i * U.columns + i] = f - g;
 
 				for (j = l - 1; j < V.rows; j++)
 				{
 					s = 0.0;
 					for (k = i; k < U.rows; k++)
-						s += U.elements[k][i] * U.elements[k][j];
+						s += U.elements[k * U.columns + i] * U.elements[k * U.columns + j];
 					f = s / h;
 					for (k = i; k < U.rows; k++)
-						U.elements[k][j] += f * U.elements[k][i];
+						U.elements[k * U.columns + j] += f * U.elements[k * U.columns + i];
 				}
 				for (k = i; k < U.rows; k++)
-					U.elements[k][i] *= scale;
+					U.elements[k * U.columns + i] *= scale;
 			}
 		}
 
-		W.elements[i][i] = scale * g;
+		W.elements[i * W.columns + i] = scale * g;
 		g = 0.0;
 		s = 0.0;
 		scale = 0.0;
@@ -1312,44 +1614,44 @@ double Matrix::ReduceToBidiagonalForm(Matrix &U, Matrix &V, Matrix &W, double *r
 		if (i < U.rows && i != V.rows - 1)
 		{
 			for (k = l - 1; k < V.rows; k++)
-				scale += fabs(U.elements[i][k]);
+				scale += fabs(U.elements[i * U.columns + k]);
 
 			if (scale != 0.0)
 			{
 				for (k = l - 1; k < V.rows; k++)
 				{
-					U.elements[i][k] /= scale;
-					s += U.elements[i][k] * U.elements[i][k];
+					U.elements[i * U.columns + k] /= scale;
+					s += U.elements[i * U.columns + k] * U.elements[i * U.columns + k];
 				}
 
-				f = U.elements[i][l - 1];
+				f = U.elements[i * U.columns + l - 1];
 				if (f >= 0.0)
 					g = -sqrt(s);
 				else
 					g =sqrt(s);
 
 				h = f * g - s;
-				U.elements[i][l - 1] = f - g;
+				U.elements[i * U.columns + l - 1] = f - g;
 
 				for (k = l - 1; k < V.rows; k++)
-					rv1[k] = U.elements[i][k] / h;
+					rv1[k] = U.elements[i * U.columns + k] / h;
 
 				for (j = l - 1; j < U.rows; j++)
 				{
 					s = 0.0;
 					for (k = l - 1; k < V.rows; k++)
-						s += U.elements[j][k] * U.elements[i][k];
+						s += U.elements[j * U.columns + k] * U.elements[i * U.columns + k];
 					for (k = l - 1; k < V.rows; k++)
-						U.elements[j][k] += s * rv1[k];
+						U.elements[j * U.columns + k] += s * rv1[k];
 				}
 
 				for (k = l - 1; k < V.rows; k++)
-					U.elements[i][k] *= scale;
+					U.elements[i * U.columns + k] *= scale;
 			}
 		}
 
-		if (anorm < fabs((W.elements[i][i]) + fabs(rv1[i])))
-			anorm = fabs(W.elements[i][i]) + fabs(rv1[i]);
+		if (anorm < fabs((W.elements[i * W.columns + i]) + fabs(rv1[i])))
+			anorm = fabs(W.elements[i * W.columns + i]) + fabs(rv1[i]);
 	}
 
 	return anorm;
@@ -1378,33 +1680,33 @@ void Matrix::AccumulateRightHandTransforms(Matrix &U, Matrix &V, const double *r
 	int i(V.rows - 1);
 	unsigned int j, l(i), k;
 	double g(rv1[i]), s;
-	V.elements[i][i] = 1.0;
+	V.elements[i * V.columns + i] = 1.0;
 
 	for (i = V.rows - 2; i >= 0; i--)
 	{
 		if (g != 0.0)
 		{
 			for (j = l; j < V.rows; j++)
-				V.elements[j][i] = (U.elements[i][j] / U.elements[i][l]) / g;
+				V.elements[j * V.columns + i] = (U.elements[i * U.columns + j] / U.elements[i * U.columns + l]) / g;
 
 			for (j = l; j < V.rows; j++)
 			{
 				s = 0.0;
 				for (k = l; k < V.rows; k++)
-					s += U.elements[i][k] * V.elements[k][j];
+					s += U.elements[i * U.columns + k] * V.elements[k * V.columns + j];
 
 				for (k = l; k < V.rows; k++)
-					V.elements[k][j] += s * V.elements[k][i];
+					V.elements[k * V.columns + j] += s * V.elements[k * V.columns + i];
 			}
 		}
 
 		for (j = l; j < V.rows; j++)
 		{
-			V.elements[i][j] = 0.0;
-			V.elements[j][i] = 0.0;
+			V.elements[i * V.columns + j] = 0.0;
+			V.elements[j * V.columns + i] = 0.0;
 		}
 
-		V.elements[i][i] = 1.0;
+		V.elements[i * V.columns + i] = 1.0;
 		g = rv1[i];
 		l = i;
 	}
@@ -1436,9 +1738,9 @@ void Matrix::AccumulateLeftHandTransforms(Matrix &U, Matrix &V, Matrix &W) const
 	for (i = GetMinimumDimension() - 1; i >= 0; i--)
 	{
 		l = i + 1;
-		g = W.elements[i][i];
+		g = W.elements[i * W.columns + i];
 		for (j = l; j < V.rows; j++)
-			U.elements[i][j] = 0.0;
+			U.elements[i * U.columns + j] = 0.0;
 
 		if (g != 0.0)
 		{
@@ -1447,22 +1749,22 @@ void Matrix::AccumulateLeftHandTransforms(Matrix &U, Matrix &V, Matrix &W) const
 			{
 				s = 0.0;
 				for (k = l; k < U.rows; k++)
-					s += U.elements[k][i] * U.elements[k][j];
+					s += U.elements[k * U.columns + i] * U.elements[k * U.columns + j];
 
-				f = (s / U.elements[i][i]) * g;
+				f = (s / U.elements[i * U.columns + i]) * g;
 				for (k = i; k < U.rows; k++)
-					U.elements[k][j] += f * U.elements[k][i];
+					U.elements[k * U.columns + j] += f * U.elements[k * U.columns + i];
 			}
 
 			for (j = i; j < U.rows; j++)
-				U.elements[j][i] *= g;
+				U.elements[j * U.columns + i] *= g;
 		}
 		else
 		{
 			for (j = i; j < U.rows; j++)
-				U.elements[j][i] = 0.0;
+				U.elements[j * U.columns + i] = 0.0;
 		}
-		U.elements[i][i]++;
+		U.elements[i * U.columns + i]++;
 	}
 }
 
@@ -1508,7 +1810,7 @@ bool Matrix::DiagonalizeBidiagonalForm(Matrix &U, Matrix &V, Matrix &W, double *
 					break;
 				}
 
-				if (fabs(W.elements[nm][nm]) <= eps * anorm)
+				if (fabs(W.elements[nm * W.columns + nm]) <= eps * anorm)
 					break;
 			}
 
@@ -1524,30 +1826,30 @@ bool Matrix::DiagonalizeBidiagonalForm(Matrix &U, Matrix &V, Matrix &W, double *
 					if (fabs(f) <= eps * anorm)
 						break;
 
-					g = W.elements[i][i];
+					g = W.elements[i * W.columns + i];
 					h = Pythag(f, g);
-					W.elements[i][i] = h;
+					W.elements[i * W.columns + i] = h;
 					h = 1.0 / h;
 					c = g * h;
 					s = -f * h;
 					for (j = 0; j < (int)U.rows; j++)
 					{
-						y = U.elements[j][nm];
-						z = U.elements[j][i];
-						U.elements[j][nm] = y * c + z * s;
-						U.elements[j][i] = z * c - y * s;
+						y = U.elements[j * U.columns + nm];
+						z = U.elements[j * U.columns + i];
+						U.elements[j * U.columns + nm] = y * c + z * s;
+						U.elements[j * U.columns + i] = z * c - y * s;
 					}
 				}
 			}
 
-			z = W.elements[k][k];
+			z = W.elements[k * W.columns + k];
 			if (l == k)
 			{
 				if (z < 0.0)
 				{
-					W.elements[k][k] = -z;
+					W.elements[k * W.columns + k] = -z;
 					for (j = 0; j < (int)V.rows; j++)
-						V.elements[j][k] = -V.elements[j][k];
+						V.elements[j * V.columns + k] = -V.elements[j * V.columns + k];
 				}
 				break;
 			}
@@ -1555,9 +1857,9 @@ bool Matrix::DiagonalizeBidiagonalForm(Matrix &U, Matrix &V, Matrix &W, double *
 			if (its == its_limit - 1)// Reached iteration limit
 				return false;
 
-			x = W.elements[l][l];
+			x = W.elements[l * W.columns + l];
 			nm = k - 1;
-			y = W.elements[nm][nm];
+			y = W.elements[nm * W.columns + nm];
 			g = rv1[nm];
 			h = rv1[k];
 			f = ((y-z) * (y+z) + (g-h) * (g+h)) / (2.0 * h * y);
@@ -1573,7 +1875,7 @@ bool Matrix::DiagonalizeBidiagonalForm(Matrix &U, Matrix &V, Matrix &W, double *
 			{
 				i = j + 1;
 				g = rv1[i];
-				y = W.elements[i][i];
+				y = W.elements[i * W.columns + i];
 				h = s * g;
 				g = c * g;
 				z = Pythag(f,h);
@@ -1587,14 +1889,14 @@ bool Matrix::DiagonalizeBidiagonalForm(Matrix &U, Matrix &V, Matrix &W, double *
 
 				for (jj = 0; jj < (int)V.rows; jj++)
 				{
-					x = V.elements[jj][j];
-					z = V.elements[jj][i];
-					V.elements[jj][j] = x * c + z * s;
-					V.elements[jj][i] = z * c - x * s;
+					x = V.elements[jj * V.columns + j];
+					z = V.elements[jj * V.columns + i];
+					V.elements[jj * V.columns + j] = x * c + z * s;
+					V.elements[jj * V.columns + i] = z * c - x * s;
 				}
 
 				z = Pythag(f, h);
-				W.elements[j][j] = z;
+				W.elements[j * W.columns + j] = z;
 
 				if (z != 0.0)
 				{
@@ -1608,16 +1910,16 @@ bool Matrix::DiagonalizeBidiagonalForm(Matrix &U, Matrix &V, Matrix &W, double *
 
 				for (jj = 0; jj < (int)U.rows; jj++)
 				{
-					y = U.elements[jj][j];
-					z = U.elements[jj][i];
-					U.elements[jj][j] = y * c + z * s;
-					U.elements[jj][i] = z * c - y * s;
+					y = U.elements[jj * U.columns + j];
+					z = U.elements[jj * U.columns + i];
+					U.elements[jj * U.columns + j] = y * c + z * s;
+					U.elements[jj * U.columns + i] = z * c - y * s;
 				}
 			}
 
 			rv1[l] = 0.0;
 			rv1[k] = f;
-			W.elements[k][k] = x;
+			W.elements[k * W.columns + k] = x;
 		}
 	}
 
@@ -1648,10 +1950,10 @@ void Matrix::RemoveZeroSingularValues(Matrix &U, Matrix &W) const
 	unsigned int i;
 	for (i = 0; i < GetMinimumDimension(); i++)
 	{
-		if (IsZero(W.elements[i][i]))
+		if (IsZero(W.elements[i * W.columns + i]))
 		{
-			W.elements[i][i] = 0.0;
-			U.elements[i][i] = 0.0;
+			W.elements[i * W.columns + i] = 0.0;
+			U.elements[i * U.columns + i] = 0.0;
 		}
 	}
 }
@@ -1693,35 +1995,35 @@ void Matrix::SortSingularValues(Matrix &U, Matrix &V, Matrix &W) const
 		its /= 3;
 		for (i = its; i < V.rows; i++)
 		{
-			sw = W.elements[i][i];
+			sw = W.elements[i * W.columns + i];
 			for (k = 0; k < U.rows; k++)
-				su[k] = U.elements[k][i];
+				su[k] = U.elements[k * U.columns + i];
 
 			for (k = 0; k < V.rows; k++)
-				sv[k] = V.elements[k][i];
+				sv[k] = V.elements[k * V.columns + i];
 
 			j = i;
-			while (W.elements[j - its][j - its] < sw)
+			while (W.elements[(j - its) * W.columns + j - its] < sw)
 			{
-				W.elements[j][j] = W.elements[j - its][j - its];
+				W.elements[j * W.columns + j] = W.elements[(j - its) * W.columns + j - its];
 				for (k = 0; k < U.rows; k++)
-					U.elements[k][j] = U.elements[k][j - its];
+					U.elements[k * U.columns + j] = U.elements[k * U.columns + j - its];
 
 				for (k = 0; k < V.rows; k++)
-					V.elements[k][j] = V.elements[k][j - its];
+					V.elements[k * V.columns + j] = V.elements[k * V.columns + j - its];
 
 				j -= its;
 				if (j < its)
 					break;
 			}
 
-			W.elements[j][j] = sw;
+			W.elements[j * W.columns + j] = sw;
 
 			for (k = 0; k < U.rows; k++)
-				U.elements[k][j] = su[k];
+				U.elements[k * U.columns + j] = su[k];
 
 			for (k = 0; k < V.rows; k++)
-				V.elements[k][j] = sv[k];
+				V.elements[k * V.columns + j] = sv[k];
 		}
 	} while (its > 1);
 
@@ -1730,23 +2032,23 @@ void Matrix::SortSingularValues(Matrix &U, Matrix &V, Matrix &W) const
 		s = 0.0;
 		for (i = 0; i < U.rows; i++)
 		{
-			if (U.elements[i][k] < 0.0)
+			if (U.elements[i * U.columns + k] < 0.0)
 				s++;
 		}
 
 		for (j = 0; j < V.rows; j++)
 		{
-			if (V.elements[j][k] < 0.0)
+			if (V.elements[j * V.columns + k] < 0.0)
 				s++;
 		}
 
 		if (s > (U.rows + V.rows) / 2)
 		{
 			for (i = 0; i < U.rows; i++)
-				U.elements[i][k] = -U.elements[i][k];
+				U.elements[i * U.columns + k] = -U.elements[i * U.columns + k];
 
 			for (j = 0; j < V.rows; j++)
-				V.elements[j][k] = -V.elements[j][k];
+				V.elements[j * V.columns + k] = -V.elements[j * V.columns + k];
 		}
 	}
 
@@ -1783,9 +2085,9 @@ Matrix& Matrix::RemoveRow(const unsigned int &row)
 		for (j = 0; j < columns; j++)
 		{
 			if (i < row)
-				elements[i][j] = original.elements[i][j];
+				elements[i * columns + j] = original.elements[i * original.columns + j];
 			else
-				elements[i][j] = original.elements[i + 1][j];
+				elements[i * columns + j] = original.elements[(i + 1) * original.columns + j];
 		}
 	}
 
@@ -1821,9 +2123,9 @@ Matrix& Matrix::RemoveColumn(const unsigned int &column)
 		for (j = 0; j < columns; j++)
 		{
 			if (j < column)
-				elements[i][j] = original.elements[i][j];
+				elements[i * columns + j] = original.elements[i * original.columns + j];
 			else
-				elements[i][j] = original.elements[i][j + 1];
+				elements[i * columns + j] = original.elements[i * original.columns + j + 1];
 		}
 	}
 
@@ -9,6 +9,7 @@
 
 // Standard C++ headers
 #include <iostream>
+#include <cassert>
 
 class Matrix
 {
@@ -34,6 +35,7 @@ public:
 
 	bool IsSquare(void) const { return rows == columns; };
 	void Resize(const unsigned int &_rows, const unsigned int &_columns);
+	void Swap(Matrix &target);
 	Matrix& RemoveRow(const unsigned int &row);
 	Matrix& RemoveColumn(const unsigned int &column);
 
@@ -58,13 +60,17 @@ public:
 	Matrix& operator*=(const double &target);
 	Matrix& operator/=(const double &target);
 	Matrix& operator=(const Matrix &target);
-	double &operator()(const unsigned int &row, const unsigned int &column);
+	inline double &operator()(const unsigned int &row, const unsigned int &column);
 	const Matrix operator+(const Matrix &target) const;
 	const Matrix operator-(const Matrix &target) const;
 	const Matrix operator*(const Matrix &target) const;
 	const Matrix operator*(const double &target) const;
 	const Matrix operator/(const double &target) const;
-	const double &operator()(const unsigned int &row, const unsigned int &column) const;
+	inline const double &operator()(const unsigned int &row, const unsigned int &column) const;
+
+	// Products written directly to the result, without temporaries
+	static void Multiply(const Matrix &left, const Matrix &right, Matrix &result);
+	static void TransposeMultiply(const Matrix &left, const Matrix &right, Matrix &result);// left^T * right
 
 	// Common matrix operations ------------------------------------
 	bool GetSingularValueDecomposition(Matrix &U, Matrix &V, Matrix &W) const;
@@ -75,6 +81,11 @@ public:
 	Matrix GetDiagonalInverse(void) const;
 
 	bool LeftDivide(const Matrix& b, Matrix &x) const;// x = A \ b
+
+	// Least-squares solutions for tall, full-rank systems (faster than LeftDivide)
+	bool SolveLeastSquaresQR(const Matrix &b, Matrix &x) const;
+	bool SolveLeastSquaresCholesky(const Matrix &b, Matrix &x,
+		const double &minimumReciprocalCondition = 1.0e-10) const;
 	Matrix GetRowReduced(void) const;
 	unsigned int GetRank(void) const;
 	
@@ -82,14 +93,16 @@ public:
 
 private:
 	static const double nearlyZero;
+	static const double rankTolerance;// Relative to largest diagonal of R
 	static bool IsZero(const double &value);
 
 	// The size of this matrix
 	unsigned int rows;
 	unsigned int columns;
 
-	// The array of elements of this matrix
-	double **elements;
+	// The elements of this matrix, stored contiguously in row-major order
+	// (element (i, j) is at i * columns + j)
+	double *elements;
 
 	void FreeElements(void);
 	void AllocateElements(void);
@@ -111,4 +124,58 @@ private:
 		const unsigned int &pivotColumn, const unsigned int &targetRow);
 };
 
+//==========================================================================
+// Class:			Matrix
+// Function:		operator ()
+//
+// Description:		Overload of the () operator for this object.  Permits accessing
+//					class data by using Matrix(row, column).  Non-const version.
+//
+// Input Arguments:
+//		row		= const unsigned int& specifying the row of the desired element (0-based)
+//		column	= const unsigned int& specifying the column of the desired element (0-based)
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		double&, reference to the specified element
+//
+//==========================================================================
+inline double &Matrix::operator () (const unsigned int &row, const unsigned int &column)
+{
+	// Make sure the indecies are valid
+	assert(row < rows && column < columns);
+
+	// Return the specified element
+	return elements[row * columns + column];
+}
+
+//==========================================================================
+// Class:			Matrix
+// Function:		operator ()
+//
+// Description:		Overload of the () operator for this object.  Permits accessing
+//					class data by using Matrix(Row, Column).  Const version.
+//
+// Input Arguments:
+//		row		= const unsigned int& specifying the row of the desired element (0-based)
+//		column	= const unsigned int& specifying the column of the desired element (0-based)
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		const double&, reference to the specified element
+//
+//==========================================================================
+inline const double &Matrix::operator () (const unsigned int &row, const unsigned int &column) const
+{
+	// Make sure the indecies are valid
+	assert(row < rows && column < columns);
+
+	// Return the specified element
+	return elements[row * columns + column];
+}
+
 #endif// MATRIX_H_
\ No newline at end of file
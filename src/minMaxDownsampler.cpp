@@ -0,0 +1,236 @@
+// File:  minMaxDownsampler.cpp
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Copy:  (c) Copyright 2026
+// Desc:  Streaming min/max downsampler for plotting long data series with a
+//        fixed amount of memory.  Samples are grouped into buckets, and only
+//        the minimum and maximum of each bucket (with their x-values) are
+//        kept, so peaks are never lost.  When all buckets are used, adjacent
+//        pairs are merged and the number of samples per bucket doubles.  All
+//        memory is allocated by the constructor.
+
+// Standard C++ headers
+#include <cassert>
+
+// Local headers
+#include "minMaxDownsampler.h"
+
+//==========================================================================
+// Class:			MinMaxDownsampler
+// Function:		MinMaxDownsampler
+//
+// Description:		Constructor for MinMaxDownsampler class.
+//
+// Input Arguments:
+//		bucketCount	= const unsigned int&, must be even and non-zero
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+MinMaxDownsampler::MinMaxDownsampler(const unsigned int &bucketCount)
+	: bucketCount(bucketCount)
+{
+	assert(bucketCount > 0 && bucketCount % 2 == 0);
+	buckets.reserve(bucketCount);
+	Reset();
+}
+
+//==========================================================================
+// Class:			MinMaxDownsampler
+// Function:		Reset
+//
+// Description:		Discards all samples.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void MinMaxDownsampler::Reset(void)
+{
+	buckets.clear();
+	current.count = 0;
+	samplesPerBucket = 1;
+	sampleCount = 0;
+}
+
+//==========================================================================
+// Class:			MinMaxDownsampler
+// Function:		Add
+//
+// Description:		Adds a sample.  x-values must be non-decreasing.
+//
+// Input Arguments:
+//		x	= const double&
+//		y	= const double&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void MinMaxDownsampler::Add(const double &x, const double &y)
+{
+	sampleCount++;
+
+	if (current.count == 0)
+	{
+		current.minX = x;
+		current.minY = y;
+		current.maxX = x;
+		current.maxY = y;
+	}
+	else if (y < current.minY)
+	{
+		current.minX = x;
+		current.minY = y;
+	}
+	else if (y > current.maxY)
+	{
+		current.maxX = x;
+		current.maxY = y;
+	}
+
+	if (++current.count < samplesPerBucket)
+		return;
+
+	buckets.push_back(current);
+	current.count = 0;
+
+	if (buckets.size() == bucketCount)
+		MergeBuckets();
+}
+
+//==========================================================================
+// Class:			MinMaxDownsampler
+// Function:		MergeBuckets
+//
+// Description:		Combines adjacent pairs of buckets, freeing half of them.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void MinMaxDownsampler::MergeBuckets(void)
+{
+	assert(buckets.size() % 2 == 0);
+
+	unsigned int i;
+	for (i = 0; i < buckets.size() / 2; i++)
+	{
+		const Bucket &first(buckets[2 * i]);
+		const Bucket &second(buckets[2 * i + 1]);
+		Bucket merged(first);
+
+		if (second.minY < merged.minY)
+		{
+			merged.minX = second.minX;
+			merged.minY = second.minY;
+		}
+
+		if (second.maxY > merged.maxY)
+		{
+			merged.maxX = second.maxX;
+			merged.maxY = second.maxY;
+		}
+
+		merged.count += second.count;
+		buckets[i] = merged;
+	}
+
+	buckets.resize(buckets.size() / 2);
+	samplesPerBucket *= 2;
+}
+
+//==========================================================================
+// Class:			MinMaxDownsampler
+// Function:		GetSeries
+//
+// Description:		Returns the downsampled series, in order of increasing x.
+//					The output vectors are cleared first; if they have been
+//					reserved to GetMaximumPointCount(), no memory is
+//					allocated.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		x	= std::vector<double>&
+//		y	= std::vector<double>&
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void MinMaxDownsampler::GetSeries(std::vector<double> &x,
+	std::vector<double> &y) const
+{
+	x.clear();
+	y.clear();
+
+	unsigned int i;
+	for (i = 0; i < buckets.size(); i++)
+		AppendBucket(buckets[i], x, y);
+
+	if (current.count > 0)
+		AppendBucket(current, x, y);
+}
+
+//==========================================================================
+// Class:			MinMaxDownsampler
+// Function:		AppendBucket
+//
+// Description:		Appends the extremes of the bucket to the output, in the
+//					order in which they occurred.
+//
+// Input Arguments:
+//		bucket	= const Bucket&
+//
+// Output Arguments:
+//		x	= std::vector<double>&
+//		y	= std::vector<double>&
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void MinMaxDownsampler::AppendBucket(const Bucket &bucket,
+	std::vector<double> &x, std::vector<double> &y)
+{
+	if (bucket.minX < bucket.maxX)
+	{
+		x.push_back(bucket.minX);
+		y.push_back(bucket.minY);
+		x.push_back(bucket.maxX);
+		y.push_back(bucket.maxY);
+	}
+	else if (bucket.minX > bucket.maxX)
+	{
+		x.push_back(bucket.maxX);
+		y.push_back(bucket.maxY);
+		x.push_back(bucket.minX);
+		y.push_back(bucket.minY);
+	}
+	else
+	{
+		x.push_back(bucket.minX);
+		y.push_back(bucket.minY);
+	}
+}
@@ -0,0 +1,52 @@
+// File:  minMaxDownsampler.h
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Copy:  (c) Copyright 2026
+// Desc:  Streaming min/max downsampler for plotting long data series with a
+//        fixed amount of memory.  Samples are grouped into buckets, and only
+//        the minimum and maximum of each bucket (with their x-values) are
+//        kept, so peaks are never lost.  When all buckets are used, adjacent
+//        pairs are merged and the number of samples per bucket doubles.  All
+//        memory is allocated by the constructor.
+
+#ifndef MIN_MAX_DOWNSAMPLER_H_
+#define MIN_MAX_DOWNSAMPLER_H_
+
+// Standard C++ headers
+#include <vector>
+
+class MinMaxDownsampler
+{
+public:
+	explicit MinMaxDownsampler(const unsigned int &bucketCount);
+
+	void Reset(void);
+	void Add(const double &x, const double &y);
+
+	// Largest number of points GetSeries() will return
+	unsigned int GetMaximumPointCount(void) const { return 2 * (bucketCount + 1); };
+	void GetSeries(std::vector<double> &x, std::vector<double> &y) const;
+
+	unsigned long GetSampleCount(void) const { return sampleCount; };
+
+private:
+	const unsigned int bucketCount;
+
+	struct Bucket
+	{
+		double minX, minY;
+		double maxX, maxY;
+		unsigned long count;
+	};
+
+	std::vector<Bucket> buckets;// Completed buckets
+	Bucket current;// Bucket being filled
+	unsigned long samplesPerBucket;
+	unsigned long sampleCount;
+
+	void MergeBuckets(void);
+	static void AppendBucket(const Bucket &bucket, std::vector<double> &x,
+		std::vector<double> &y);
+};
+
+#endif// MIN_MAX_DOWNSAMPLER_H_
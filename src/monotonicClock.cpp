@@ -0,0 +1,62 @@
+// File:  monotonicClock.cpp
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Copy:  (c) Copyright 2026
+// Desc:  Shared high-resolution time source.  Uses CLOCK_MONOTONIC, so it is
+//        unaffected by changes to the system time (e.g. NTP steps).  Times are
+//        measured from an arbitrary fixed point, so only differences between
+//        times are meaningful.
+
+// *nix headers
+#include <time.h>
+
+// Local headers
+#include "monotonicClock.h"
+
+//==========================================================================
+// Class:			MonotonicClock
+// Function:		GetTime
+//
+// Description:		Returns the current time.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		double [sec]
+//
+//==========================================================================
+double MonotonicClock::GetTime(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + now.tv_nsec * 1.0e-9;
+}
+
+//==========================================================================
+// Class:			MonotonicClock
+// Function:		GetMilliseconds
+//
+// Description:		Returns the current time as an integer number of
+//					milliseconds.  The value wraps, so only differences
+//					(computed with unsigned arithmetic) are meaningful.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		unsigned int [msec]
+//
+//==========================================================================
+unsigned int MonotonicClock::GetMilliseconds(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return static_cast<unsigned int>(now.tv_sec) * 1000 + now.tv_nsec / 1000000;
+}
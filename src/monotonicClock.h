@@ -0,0 +1,22 @@
+// File:  monotonicClock.h
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Copy:  (c) Copyright 2026
+// Desc:  Shared high-resolution time source.  Uses CLOCK_MONOTONIC, so it is
+//        unaffected by changes to the system time (e.g. NTP steps).  Times are
+//        measured from an arbitrary fixed point, so only differences between
+//        times are meaningful.
+
+#ifndef MONOTONIC_CLOCK_H_
+#define MONOTONIC_CLOCK_H_
+
+class MonotonicClock
+{
+public:
+	static double GetTime(void);// [sec]
+	static unsigned int GetMilliseconds(void);// [msec] (wraps after ~49 days)
+
+	static double GetElapsedTime(const double &since) { return GetTime() - since; };// [sec]
+};
+
+#endif// MONOTONIC_CLOCK_H_
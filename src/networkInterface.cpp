@@ -5,17 +5,50 @@
 // Desc:  Interface for Ethernet communication with front end.
 
 // Standard C++ headers
-#include <string.h>
-
-// cJSON headers
-#include "cJSON.h"
+#include <string>
+#include <cstring>
+#include <cassert>
 
 // Local headers
 #include "networkInterface.h"
 #include "sousVideConfig.h"
 #include "networkMessageDefs.h"
 #include "linuxSocket.h"
-#include "mutexLocker.h"
+#include "jsonWriter.h"
+#include "jsonReader.h"
+#include "monotonicClock.h"
+#include "loopStatistics.h"
+#include "timingHistogram.h"
+#include "timeHistoryBuffer.h"
+
+//==========================================================================
+// Class:			NetworkInterface
+// Function:		Constant definitions
+//
+// Description:		Constant definitions for NetworkInterface class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+const unsigned int NetworkInterface::inboundQueueSize = 32;
+
+// Worst cases assume every number is written at full length (up to 23
+// characters for doubles and 20 digits for counts - about 46 bytes per
+// histogram bucket), plus room for keys and punctuation
+const unsigned int NetworkInterface::maxHistogramLength
+	= 128 + TimingHistogram::bucketCount * 48;// [bytes]
+const unsigned int NetworkInterface::maxStateStatisticsLength
+	= 128 + 2 * maxHistogramLength;// [bytes]
+const unsigned int NetworkInterface::sendBufferSize
+	= 512 + SousVide::StateCount * maxStateStatisticsLength;// [bytes]
+const unsigned int NetworkInterface::historyReplySize;// Value given in header
 
 //==========================================================================
 // Class:			NetworkInterface
@@ -35,13 +68,26 @@
 //
 //==========================================================================
 NetworkInterface::NetworkInterface(NetworkConfiguration configuration,
-	std::ostream &outStream) : outStream(outStream)
+	std::ostream &outStream) : outStream(outStream),
+	inboundQueue(inboundQueueSize)
 {
+	reportedOverflowCount = 0;
+	sendBuffer = new char[sendBufferSize];
+
 	socket = new LinuxSocket(LinuxSocket::SocketTCPServer, outStream);
+	socket->SetMessageHandler(&NetworkInterface::MessageReceived, this);
 	socket->Create(configuration.port);
 	socket->SetBlocking(false);
 
-	buffer = new char[LinuxSocket::maxMessageSize];
+	telemetrySequence = 0;
+	startTime = MonotonicClock::GetMilliseconds();
+	if (configuration.telemetryPort == 0)
+		telemetrySocket = NULL;
+	else
+	{
+		telemetrySocket = new LinuxSocket(LinuxSocket::SocketTCPServer, outStream);
+		telemetrySocket->Create(configuration.telemetryPort);
+	}
 }
 
 //==========================================================================
@@ -63,14 +109,16 @@ NetworkInterface::NetworkInterface(NetworkConfiguration configuration,
 NetworkInterface::~NetworkInterface()
 {
 	delete socket;
-	delete [] buffer;
+	delete telemetrySocket;
+	delete [] sendBuffer;
 }
 
 //==========================================================================
 // Class:			NetworkInterface
 // Function:		ReceiveData
 //
-// Description:		Gets data from socket, if available.
+// Description:		Gets the oldest pending message, if available.  Never
+//					blocks.  Call repeatedly to drain all pending messages.
 //
 // Input Arguments:
 //		None
@@ -84,34 +132,67 @@ NetworkInterface::~NetworkInterface()
 //==========================================================================
 bool NetworkInterface::ReceiveData(FrontToBackMessage &message)
 {
-	MutexLocker locker(socket->GetMutex());
-
-	int bytesReceived = socket->Receive();
-	if (bytesReceived < (int)sizeof(message))
-		return false;
-	else if (bytesReceived == sizeof(message))
+	const unsigned int overflowCount(inboundQueue.GetOverflowCount());
+	if (overflowCount != reportedOverflowCount)
 	{
-		memcpy(buffer, socket->GetLastMessage(), LinuxSocket::maxMessageSize);
-		std::string stringBuffer(buffer);
-		if (!DecodeMessage(stringBuffer, message))
-			return false;
+		outStream << "Inbound message queue full; dropped "
+			<< overflowCount - reportedOverflowCount << " message(s) ("
+			<< overflowCount << " total)" << std::endl;
+		reportedOverflowCount = overflowCount;
+	}
 
-		return true;
+	return inboundQueue.Pop(message);
+}
+
+//==========================================================================
+// Class:			NetworkInterface
+// Function:		MessageReceived
+//
+// Description:		Callback for socket thread.  Decodes the message and
+//					queues it for the control loop.
+//
+// Input Arguments:
+//		context	= void*, pointer to NetworkInterface object
+//		buffer	= unsigned char*, one NUL-terminated frame (parsed in place)
+//		size	= const int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void NetworkInterface::MessageReceived(void *context,
+	unsigned char *buffer, const int &size)
+{
+	NetworkInterface *ni = static_cast<NetworkInterface*>(context);
+
+	JSONReader reader;
+	if (!reader.Parse(reinterpret_cast<char*>(buffer)))
+	{
+		ni->outStream << "Malformed " << size << " byte message (" << reader.GetErrorMessage()
+			<< " at offset " << reader.GetErrorOffset() << ")" << std::endl;
+		return;
 	}
-	else
+
+	FrontToBackMessage message;
+	if (!DecodeMessage(reader, message))
 	{
-		// TODO:  Do some extra work in case multiple messages arrive at the same time?
-		outStream << "Message size mismatch in NetworkInterface::ReceiveData" << std::endl;
+		ni->outStream << "Failed to decode message in NetworkInterface::MessageReceived" << std::endl;
+		return;
 	}
 
-	return false;
+	ni->inboundQueue.Push(message);
 }
 
 //==========================================================================
 // Class:			NetworkInterface
 // Function:		SendData
 //
-// Description:		Sends data to all connected clients.
+// Description:		Sends data to all connected clients.  Each message is
+//					encoded into a buffer owned by this object and terminated
+//					with the frame delimiter.
 //
 // Input Arguments:
 //		message	= const BackToFrontMessage&
@@ -128,10 +209,139 @@ bool NetworkInterface::SendData(const BackToFrontMessage &message)
 	if (socket->GetClientCount() == 0)
 		return true;
 		
-	std::string stringBuffer;
-	if (!EncodeMessage(message, stringBuffer))
+	// Leave room for the delimiter
+	JSONWriter writer(sendBuffer, sendBufferSize - 1);
+	if (!EncodeMessage(message, writer))
+	{
+		outStream << "Message exceeds send buffer size in NetworkInterface::SendData" << std::endl;
 		return false;
-	return socket->TCPSend(stringBuffer.c_str(), stringBuffer.length());
+	}
+
+	return SendBuffer(writer);
+}
+
+//==========================================================================
+// Class:			NetworkInterface
+// Function:		SendLoopStatistics
+//
+// Description:		Sends the control loop statistics to all connected
+//					clients.  Only states for which samples have been
+//					recorded are included.  The outbound queue statistics
+//					for each socket are also included.
+//
+// Input Arguments:
+//		statistics	= const LoopStatistics&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool NetworkInterface::SendLoopStatistics(const LoopStatistics &statistics)
+{
+	if (socket->GetClientCount() == 0)
+		return true;
+
+	// Leave room for the delimiter
+	JSONWriter writer(sendBuffer, sendBufferSize - 1);
+	if (!EncodeLoopStatistics(statistics, writer))
+	{
+		outStream << "Message exceeds send buffer size in NetworkInterface::SendLoopStatistics" << std::endl;
+		return false;
+	}
+
+	return SendBuffer(writer);
+}
+
+//==========================================================================
+// Class:			NetworkInterface
+// Function:		SendHistory
+//
+// Description:		Sends the requested controller samples to all connected
+//					clients.
+//
+// Input Arguments:
+//		history	= const TimeHistoryBuffer&
+//		request	= const FrontToBackMessage&, the CmdGetHistory message
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool NetworkInterface::SendHistory(const TimeHistoryBuffer &history,
+	const FrontToBackMessage &request)
+{
+	if (socket->GetClientCount() == 0)
+		return true;
+
+	// Leave room for the delimiter
+	JSONWriter writer(sendBuffer, sendBufferSize - 1);
+	if (!EncodeHistory(history, request, writer))
+	{
+		outStream << "Message exceeds send buffer size in NetworkInterface::SendHistory" << std::endl;
+		return false;
+	}
+
+	return SendBuffer(writer);
+}
+
+//==========================================================================
+// Class:			NetworkInterface
+// Function:		SendBuffer
+//
+// Description:		Terminates the message in the send buffer with the frame
+//					delimiter and sends it to all connected clients.
+//
+// Input Arguments:
+//		writer	= const JSONWriter&, which wrote the message into sendBuffer
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool NetworkInterface::SendBuffer(const JSONWriter &writer)
+{
+	assert(writer.GetString() == sendBuffer);
+
+	unsigned int length(writer.GetLength());
+	sendBuffer[length++] = LinuxSocket::frameDelimiter;
+	return socket->TCPSend(sendBuffer, length);
+}
+
+//==========================================================================
+// Class:			NetworkInterface
+// Function:		SendTelemetry
+//
+// Description:		Sends a binary telemetry frame to all clients connected
+//					to the telemetry port.  The frame is encoded into a
+//					buffer owned by this object, so no memory is allocated.
+//
+// Input Arguments:
+//		message	= const TelemetryMessage&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool NetworkInterface::SendTelemetry(const TelemetryMessage &message)
+{
+	if (!telemetrySocket || telemetrySocket->GetClientCount() == 0)
+		return true;
+
+	EncodeTelemetry(message, telemetrySequence++,
+		MonotonicClock::GetMilliseconds() - startTime, telemetryBuffer);
+	return telemetrySocket->TCPSend(telemetryBuffer, TelemetryFormat::frameSize);
 }
 
 //==========================================================================
@@ -159,10 +369,10 @@ bool NetworkInterface::ClientConnected(void) const
 // Class:			NetworkInterface
 // Function:		DecodeMessage
 //
-// Description:		Decodes the JSON-encoded message.
+// Description:		Extracts the message contents from the parsed JSON.
 //
 // Input Arguments:
-//		buffer	= const std::string&
+//		reader	= const JSONReader&, containing a successfully parsed message
 //
 // Output Arguments:
 //		message	= FrontToBackMessage&
@@ -171,28 +381,35 @@ bool NetworkInterface::ClientConnected(void) const
 //		bool, true if decode is successful, false otherwise
 //
 //==========================================================================
-bool NetworkInterface::DecodeMessage(const std::string &buffer,
+bool NetworkInterface::DecodeMessage(const JSONReader &reader,
 	FrontToBackMessage &message)
 {
-	cJSON *root = cJSON_Parse(buffer.c_str());
-	if (!root)
-		return false;
-
 	int command;
-	if (!ReadJSON(root, JSONKeys::CommandKey, command))
+	if (!reader.Read(JSONKeys::CommandKey.c_str(), command))
 		return false;
 	message.command = (SousVide::Command)command;
 
 	if (message.command == SousVide::CmdStart)
 	{
-		if (!ReadJSON(root, JSONKeys::PlateauTemperatureKey, message.plateauTemperature))
+		if (!reader.Read(JSONKeys::PlateauTemperatureKey.c_str(), message.plateauTemperature))
 			return false;
 
-		if (!ReadJSON(root, JSONKeys::SoakTimeKey, message.soakTime))
+		if (!reader.Read(JSONKeys::SoakTimeKey.c_str(), message.soakTime))
 			return false;
 	}
 
-	cJSON_Delete(root);
+	message.hasHistoryWindow = false;
+	if (message.command == SousVide::CmdGetHistory)
+	{
+		// The window is optional, but must have both ends if present
+		const bool hasStart(reader.Read(JSONKeys::HistoryStartKey.c_str(),
+			message.historyStartTime));
+		const bool hasEnd(reader.Read(JSONKeys::HistoryEndKey.c_str(),
+			message.historyEndTime));
+		if (hasStart != hasEnd)
+			return false;
+		message.hasHistoryWindow = hasStart;
+	}
 
 	return true;
 }
@@ -202,120 +419,333 @@ bool NetworkInterface::DecodeMessage(const std::string &buffer,
 // Function:		EncodeMessage
 //
 // Description:		Encodes the message into the JSON format expected by
-//					the clients.
+//					the clients.  Output is compact, so that it never
+//					contains the frame delimiter.
 //
 // Input Arguments:
 //		message	= const BackToFrontMessage&
 //
 // Output Arguments:
-//		buffer	= std::string&
+//		writer	= JSONWriter&
 //
 // Return Value:
-//		bool, true if encode is successful, false otherwise
+//		bool, true if encode is successful (message fit in the buffer),
+//		false otherwise
 //
 //==========================================================================
 bool NetworkInterface::EncodeMessage(const BackToFrontMessage &message,
-	std::string &buffer)
+	JSONWriter &writer)
 {
-	cJSON *root = cJSON_CreateObject();
-	cJSON_AddStringToObject(root, JSONKeys::StateKey.c_str(), message.state.c_str());
-	cJSON_AddStringToObject(root, JSONKeys::ErrorMessageKey.c_str(), message.errorMessage.c_str());
-	cJSON_AddNumberToObject(root, JSONKeys::CommandedTemperatureKey.c_str(), message.commandedTemperature);
-	cJSON_AddNumberToObject(root, JSONKeys::ActualTemperatureKey.c_str(), message.actualTemperature);
+	writer.BeginObject();
+	writer.Write(JSONKeys::StateKey.c_str(), message.state.c_str());
+	writer.Write(JSONKeys::ErrorMessageKey.c_str(), message.errorMessage.c_str());
+	writer.Write(JSONKeys::CommandedTemperatureKey.c_str(), message.commandedTemperature);
+	writer.Write(JSONKeys::ActualTemperatureKey.c_str(), message.actualTemperature);
+
+	if (message.hasAutoTuneEstimate)
+	{
+		const RecursiveIdentifier::Estimate &estimate(message.autoTuneEstimate);
+		writer.BeginObject(JSONKeys::AutoTuneKey.c_str());
+		writer.Write(JSONKeys::C1Key.c_str(), estimate.c1);
+		writer.Write(JSONKeys::C1StdDevKey.c_str(), estimate.c1StandardDeviation);
+		writer.Write(JSONKeys::C2Key.c_str(), estimate.c2);
+		writer.Write(JSONKeys::C2StdDevKey.c_str(), estimate.c2StandardDeviation);
+		writer.Write(JSONKeys::TauKey.c_str(), estimate.tau);
+		writer.Write(JSONKeys::AmbientTemperatureKey.c_str(), estimate.ambientTemperature);
+		writer.Write(JSONKeys::SampleCountKey.c_str(), static_cast<double>(estimate.sampleCount));
+		writer.Write(JSONKeys::ConvergedKey.c_str(), message.autoTuneConverged);
+		writer.EndObject();
+	}
+
 	// TODO:  Tell front end when to enable/disable buttons?
+	writer.EndObject();
 
-	buffer.assign(cJSON_Print(root));
-	cJSON_Delete(root);
+	return writer.IsOK();
+}
 
-	return true;
+//==========================================================================
+// Class:			NetworkInterface
+// Function:		EncodeLoopStatistics
+//
+// Description:		Encodes the loop statistics and the socket send
+//					statistics into JSON.  Times are in seconds.
+//
+// Input Arguments:
+//		statistics	= const LoopStatistics&
+//
+// Output Arguments:
+//		writer	= JSONWriter&
+//
+// Return Value:
+//		bool, true if encode is successful (message fit in the buffer),
+//		false otherwise
+//
+//==========================================================================
+bool NetworkInterface::EncodeLoopStatistics(const LoopStatistics &statistics,
+	JSONWriter &writer) const
+{
+	writer.BeginObject();
+	writer.BeginArray(JSONKeys::LoopStatisticsKey.c_str());
+
+	unsigned int i;
+	for (i = 0; i < statistics.GetStateCount(); i++)
+	{
+		const LoopStatistics::StateStatistics &s(statistics.Get(i));
+		if (s.workTime.GetTotalCount() == 0 && s.period.GetTotalCount() == 0)
+			continue;
+
+		writer.BeginObject();
+		writer.Write(JSONKeys::StateKey.c_str(),
+			SousVide::GetStateName(static_cast<SousVide::State>(i)).c_str());
+		writer.Write(JSONKeys::OverrunCountKey.c_str(), static_cast<double>(s.overrunCount));
+		EncodeHistogram(JSONKeys::PeriodKey.c_str(), s.period, writer);
+		EncodeHistogram(JSONKeys::WorkTimeKey.c_str(), s.workTime, writer);
+		writer.EndObject();
+	}
+
+	writer.EndArray();
+
+	EncodeSendStatistics(JSONKeys::SendStatisticsKey.c_str(), *socket, writer);
+	if (telemetrySocket)
+		EncodeSendStatistics(JSONKeys::TelemetrySendStatisticsKey.c_str(),
+			*telemetrySocket, writer);
+
+	writer.EndObject();
+
+	return writer.IsOK();
 }
 
 //==========================================================================
 // Class:			NetworkInterface
-// Function:		ReadJSON
+// Function:		EncodeHistogram
 //
-// Description:		Reads the value associated with the specified key.
+// Description:		Encodes a timing histogram into JSON.  Only non-empty
+//					buckets are written, each as [upper limit, count].  The
+//					last bucket has no upper limit, so its limit is null.
 //
 // Input Arguments:
-//		parent	= cJSON* containing the key-value pair
-//		key		= std::string to read
+//		key			= const char*
+//		histogram	= const TimingHistogram&
 //
 // Output Arguments:
-//		value	= double&
+//		writer	= JSONWriter&
 //
 // Return Value:
-//		bool, true if read is successful, false otherwise
+//		None
 //
 //==========================================================================
-bool NetworkInterface::ReadJSON(cJSON *parent, std::string key,
-	double &value)
+void NetworkInterface::EncodeHistogram(const char *key,
+	const TimingHistogram &histogram, JSONWriter &writer)
 {
-	cJSON *item;
-	item = cJSON_GetObjectItem(parent, key.c_str());
-	if (!item)
-		return false;
+	writer.BeginObject(key);
+	writer.Write(JSONKeys::SampleCountKey.c_str(), static_cast<double>(histogram.GetTotalCount()));
+	writer.Write(JSONKeys::MeanKey.c_str(), histogram.GetMean());
+	writer.Write(JSONKeys::MaximumKey.c_str(), histogram.GetMaximum());
 
-	value = item->valuedouble;
+	writer.BeginArray(JSONKeys::BucketsKey.c_str());
+	unsigned int i;
+	for (i = 0; i < TimingHistogram::bucketCount; i++)
+	{
+		if (histogram.GetCount(i) == 0)
+			continue;
 
-	return true;
+		writer.BeginArray();
+		if (i == TimingHistogram::bucketCount - 1)
+			writer.WriteNull(NULL);
+		else
+			writer.Write(NULL, TimingHistogram::GetBucketUpperLimit(i));
+		writer.Write(NULL, static_cast<double>(histogram.GetCount(i)));
+		writer.EndArray();
+	}
+	writer.EndArray();
+
+	writer.EndObject();
 }
 
 //==========================================================================
 // Class:			NetworkInterface
-// Function:		ReadJSON
+// Function:		EncodeSendStatistics
 //
-// Description:		Reads the value associated with the specified key.
+// Description:		Encodes the outbound queue statistics of a TCP server
+//					socket into JSON.
 //
 // Input Arguments:
-//		parent	= cJSON* containing the key-value pair
-//		key		= std::string to read
+//		key		= const char*
+//		socket	= const LinuxSocket&
 //
 // Output Arguments:
-//		value	= int&
+//		writer	= JSONWriter&
 //
 // Return Value:
-//		bool, true if read is successful, false otherwise
+//		None
 //
 //==========================================================================
-bool NetworkInterface::ReadJSON(cJSON *parent, std::string key,
-	int &value)
+void NetworkInterface::EncodeSendStatistics(const char *key,
+	const LinuxSocket &socket, JSONWriter &writer)
 {
-	cJSON *item;
-	item = cJSON_GetObjectItem(parent, key.c_str());
-	if (!item)
-		return false;
+	const LinuxSocket::SendStatistics statistics(socket.GetSendStatistics());
 
-	value = item->valueint;
+	writer.BeginObject(key);
+	writer.Write(JSONKeys::BytesQueuedKey.c_str(), static_cast<double>(statistics.bytesQueued));
+	writer.Write(JSONKeys::BytesDroppedKey.c_str(), static_cast<double>(statistics.bytesDropped));
+	writer.Write(JSONKeys::ClientsDroppedKey.c_str(), static_cast<double>(statistics.clientsDropped));
+	writer.EndObject();
+}
 
-	return true;
+//==========================================================================
+// Class:			NetworkInterface
+// Function:		EncodeHistory
+//
+// Description:		Encodes the controller samples within the requested window
+//					(the oldest historyReplySize of them), or the most recent
+//					samples if no window was requested.  Window times and
+//					sample times are both relative to the newest sample in
+//					the buffer.  Each sample is an array of time [sec],
+//					state, commanded temperature [deg F], actual temperature
+//					[deg F] and PWM duty [-].
+//
+// Input Arguments:
+//		history	= const TimeHistoryBuffer&
+//		request	= const FrontToBackMessage&
+//
+// Output Arguments:
+//		writer	= JSONWriter&
+//
+// Return Value:
+//		bool, true if the message fit in the buffer, false otherwise
+//
+//==========================================================================
+bool NetworkInterface::EncodeHistory(const TimeHistoryBuffer &history,
+	const FrontToBackMessage &request, JSONWriter &writer)
+{
+	TimeHistoryBuffer::Sample samples[historyReplySize];
+	TimeHistoryBuffer::Sample newest;
+	unsigned int count(0);
+	if (history.GetMostRecent(newest))
+	{
+		if (request.hasHistoryWindow)
+			count = history.GetWindow(newest.time + request.historyStartTime,
+				newest.time + request.historyEndTime, samples, historyReplySize);
+		else
+			count = history.GetLatest(samples, historyReplySize);
+	}
+
+	writer.BeginObject();
+	writer.BeginArray(JSONKeys::HistoryKey.c_str());
+
+	unsigned int i;
+	for (i = 0; i < count; i++)
+	{
+		writer.BeginArray();
+		writer.Write(NULL, samples[i].time - newest.time);
+		writer.Write(NULL, SousVide::GetStateName(
+			static_cast<SousVide::State>(samples[i].state)).c_str());
+		writer.Write(NULL, samples[i].commandedTemperature);
+		writer.Write(NULL, samples[i].actualTemperature);
+		writer.Write(NULL, samples[i].pwmDuty);
+		writer.EndArray();
+	}
+
+	writer.EndArray();
+	writer.EndObject();
+
+	return writer.IsOK();
 }
 
 //==========================================================================
 // Class:			NetworkInterface
-// Function:		ReadJSON
+// Function:		EncodeTelemetry
 //
-// Description:		Reads the value associated with the specified key.
+// Description:		Encodes the message into the binary telemetry format (see
+//					networkMessageDefs.h).
 //
 // Input Arguments:
-//		parent	= cJSON* containing the key-value pair
-//		key		= std::string to read
+//		message		= const TelemetryMessage&
+//		sequence	= const unsigned int&
+//		timestamp	= const unsigned int& [msec]
 //
 // Output Arguments:
-//		value	= std::string&
+//		buffer		= unsigned char*, must hold TelemetryFormat::frameSize bytes
 //
 // Return Value:
-//		bool, true if read is successful, false otherwise
+//		None
 //
 //==========================================================================
-bool NetworkInterface::ReadJSON(cJSON *parent, std::string key,
-	std::string &value)
+void NetworkInterface::EncodeTelemetry(const TelemetryMessage &message,
+	const unsigned int &sequence, const unsigned int &timestamp,
+	unsigned char *buffer)
 {
-	cJSON *item;
-	item = cJSON_GetObjectItem(parent, key.c_str());
-	if (!item)
-		return false;
+	unsigned char *p(buffer);
+	p = WriteLittleEndian(p, TelemetryFormat::magic, 2);
+	p = WriteLittleEndian(p, TelemetryFormat::version, 1);
+	p = WriteLittleEndian(p, message.state, 1);
+	p = WriteLittleEndian(p, sequence, 4);
+	p = WriteLittleEndian(p, timestamp, 4);
+	p = WriteFloat(p, message.commandedTemperature);
+	p = WriteFloat(p, message.actualTemperature);
+	p = WriteFloat(p, message.pwmDuty);
+	p = WriteFloat(p, message.proportionalTerm);
+	p = WriteFloat(p, message.integralTerm);
+	p = WriteFloat(p, message.derivativeTerm);
+	p = WriteFloat(p, message.feedForwardTerm);
 
-	value = item->valuestring;
+	assert(p == buffer + TelemetryFormat::frameSize);
+}
 
-	return true;
+//==========================================================================
+// Class:			NetworkInterface
+// Function:		WriteLittleEndian
+//
+// Description:		Writes the least significant size bytes of value to the
+//					buffer, least significant byte first.
+//
+// Input Arguments:
+//		buffer	= unsigned char*
+//		value	= const unsigned int&
+//		size	= const unsigned int& [bytes]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		unsigned char*, pointing to the byte following the written value
+//
+//==========================================================================
+unsigned char* NetworkInterface::WriteLittleEndian(unsigned char *buffer,
+	const unsigned int &value, const unsigned int &size)
+{
+	unsigned int i;
+	for (i = 0; i < size; i++)
+		buffer[i] = (value >> (8 * i)) & 0xFF;
+
+	return buffer + size;
+}
+
+//==========================================================================
+// Class:			NetworkInterface
+// Function:		WriteFloat
+//
+// Description:		Writes the value to the buffer as a little-endian, single
+//					precision float.
+//
+// Input Arguments:
+//		buffer	= unsigned char*
+//		value	= const double&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		unsigned char*, pointing to the byte following the written value
+//
+//==========================================================================
+unsigned char* NetworkInterface::WriteFloat(unsigned char *buffer,
+	const double &value)
+{
+	const float singleValue(static_cast<float>(value));
+	unsigned int bits;
+	assert(sizeof(bits) == sizeof(singleValue));
+	memcpy(&bits, &singleValue, sizeof(bits));
+
+	return WriteLittleEndian(buffer, bits, sizeof(bits));
 }
@@ -11,14 +11,18 @@
 #include <string>
 #include <iostream>
 
-// cJSON forward declarations
-struct cJSON;
+// Local headers
+#include "networkMessageDefs.h"
+#include "spscQueue.h"
 
 // Local forward declarations
 struct NetworkConfiguration;
-struct FrontToBackMessage;
-struct BackToFrontMessage;
 class LinuxSocket;
+class JSONWriter;
+class JSONReader;
+class LoopStatistics;
+class TimingHistogram;
+class TimeHistoryBuffer;
 
 class NetworkInterface
 {
@@ -28,23 +32,63 @@ public:
 
 	bool ReceiveData(FrontToBackMessage &message);
 	bool SendData(const BackToFrontMessage &message);
+	bool SendTelemetry(const TelemetryMessage &message);
+	bool SendLoopStatistics(const LoopStatistics &statistics);
+	bool SendHistory(const TimeHistoryBuffer &history,
+		const FrontToBackMessage &request);
 
 	bool ClientConnected(void) const;
 
+	unsigned int GetDroppedMessageCount(void) const { return inboundQueue.GetOverflowCount(); };
+
 private:
 	std::ostream &outStream;
 
 	LinuxSocket *socket;
-	char *buffer;
 
-	static bool DecodeMessage(const std::string &buffer,
+	// The largest message is the loop statistics, with every histogram bucket
+	// of every state filled; sendBufferSize is derived from its worst case
+	static const unsigned int maxHistogramLength;// [bytes]
+	static const unsigned int maxStateStatisticsLength;// [bytes]
+	static const unsigned int sendBufferSize;// [bytes]
+	static const unsigned int historyReplySize = 40;// [samples]
+	char *sendBuffer;
+
+	// Decoded messages are handed from the socket thread (producer) to the
+	// control loop (consumer) through this queue
+	static const unsigned int inboundQueueSize;
+	SPSCQueue<FrontToBackMessage> inboundQueue;
+	unsigned int reportedOverflowCount;
+
+	static void MessageReceived(void *context, unsigned char *buffer,
+		const int &size);
+
+	// Binary telemetry stream (socket is NULL if disabled)
+	LinuxSocket *telemetrySocket;
+	unsigned char telemetryBuffer[TelemetryFormat::frameSize];
+	unsigned int telemetrySequence;
+	unsigned int startTime;// [msec]
+
+	static void EncodeTelemetry(const TelemetryMessage &message,
+		const unsigned int &sequence, const unsigned int &timestamp,
+		unsigned char *buffer);
+	static unsigned char* WriteLittleEndian(unsigned char *buffer,
+		const unsigned int &value, const unsigned int &size);
+	static unsigned char* WriteFloat(unsigned char *buffer, const double &value);
+
+	static bool DecodeMessage(const JSONReader &reader,
 		FrontToBackMessage &message);
 	static bool EncodeMessage(const BackToFrontMessage &message,
-		std::string &buffer);
-
-	static bool ReadJSON(cJSON *parent, std::string key, double &value);
-	static bool ReadJSON(cJSON *parent, std::string key, int &value);
-	static bool ReadJSON(cJSON *parent, std::string key, std::string &value);
+		JSONWriter &writer);
+	bool EncodeLoopStatistics(const LoopStatistics &statistics,
+		JSONWriter &writer) const;
+	static void EncodeHistogram(const char *key,
+		const TimingHistogram &histogram, JSONWriter &writer);
+	static void EncodeSendStatistics(const char *key,
+		const LinuxSocket &socket, JSONWriter &writer);
+	static bool EncodeHistory(const TimeHistoryBuffer &history,
+		const FrontToBackMessage &request, JSONWriter &writer);
+	bool SendBuffer(const JSONWriter &writer);
 };
 
 #endif// NETWORK_INTERFACE_H_
@@ -34,3 +34,50 @@ const std::string JSONKeys::StateKey				= "State";
 const std::string JSONKeys::ErrorMessageKey			= "ErrMesg";
 const std::string JSONKeys::CommandedTemperatureKey	= "CmdTemp";
 const std::string JSONKeys::ActualTemperatureKey	= "ActTemp";
+
+const std::string JSONKeys::LoopStatisticsKey		= "LoopStats";
+const std::string JSONKeys::OverrunCountKey			= "Overruns";
+const std::string JSONKeys::PeriodKey				= "Period";
+const std::string JSONKeys::WorkTimeKey				= "WorkTime";
+const std::string JSONKeys::SampleCountKey			= "Count";
+const std::string JSONKeys::MeanKey					= "Mean";
+const std::string JSONKeys::MaximumKey				= "Max";
+const std::string JSONKeys::BucketsKey				= "Buckets";
+const std::string JSONKeys::SendStatisticsKey		= "SendStats";
+const std::string JSONKeys::TelemetrySendStatisticsKey	= "TelemSendStats";
+const std::string JSONKeys::BytesQueuedKey			= "BytesQueued";
+const std::string JSONKeys::BytesDroppedKey			= "BytesDropped";
+const std::string JSONKeys::ClientsDroppedKey		= "ClientsDropped";
+
+const std::string JSONKeys::HistoryKey				= "History";
+const std::string JSONKeys::HistoryStartKey			= "HistStart";
+const std::string JSONKeys::HistoryEndKey			= "HistEnd";
+
+const std::string JSONKeys::AutoTuneKey				= "AutoTune";
+const std::string JSONKeys::C1Key					= "C1";
+const std::string JSONKeys::C1StdDevKey				= "C1StdDev";
+const std::string JSONKeys::C2Key					= "C2";
+const std::string JSONKeys::C2StdDevKey				= "C2StdDev";
+const std::string JSONKeys::TauKey					= "Tau";
+const std::string JSONKeys::AmbientTemperatureKey	= "AmbTemp";
+const std::string JSONKeys::ConvergedKey			= "Converged";
+
+//==========================================================================
+// Class:			TelemetryFormat
+// Function:		None
+//
+// Description:		Static Member Definition (values are given in the header)
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+const unsigned short TelemetryFormat::magic;
+const unsigned char TelemetryFormat::version;
+const unsigned int TelemetryFormat::frameSize;
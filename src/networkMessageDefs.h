@@ -24,6 +24,33 @@ struct JSONKeys
 	static const std::string ErrorMessageKey;
 	static const std::string CommandedTemperatureKey;
 	static const std::string ActualTemperatureKey;
+
+	static const std::string LoopStatisticsKey;
+	static const std::string OverrunCountKey;
+	static const std::string PeriodKey;
+	static const std::string WorkTimeKey;
+	static const std::string SampleCountKey;
+	static const std::string MeanKey;
+	static const std::string MaximumKey;
+	static const std::string BucketsKey;
+	static const std::string SendStatisticsKey;
+	static const std::string TelemetrySendStatisticsKey;
+	static const std::string BytesQueuedKey;
+	static const std::string BytesDroppedKey;
+	static const std::string ClientsDroppedKey;
+
+	static const std::string HistoryKey;
+	static const std::string HistoryStartKey;
+	static const std::string HistoryEndKey;
+
+	static const std::string AutoTuneKey;
+	static const std::string C1Key;
+	static const std::string C1StdDevKey;
+	static const std::string C2Key;
+	static const std::string C2StdDevKey;
+	static const std::string TauKey;
+	static const std::string AmbientTemperatureKey;
+	static const std::string ConvergedKey;
 };
 
 // Structures for passing in and out of network interface
@@ -34,6 +61,11 @@ struct FrontToBackMessage
 
 	double plateauTemperature;// [deg F]
 	double soakTime;// [sec]
+
+	// Optional for CmdGetHistory; times are relative to the newest sample
+	bool hasHistoryWindow;
+	double historyStartTime;// [sec]
+	double historyEndTime;// [sec]
 };
 
 struct BackToFrontMessage
@@ -43,6 +75,49 @@ struct BackToFrontMessage
 
 	double commandedTemperature;// [deg F]
 	double actualTemperature;// [deg F]
+
+	// Only sent while auto-tuning
+	bool hasAutoTuneEstimate;
+	bool autoTuneConverged;
+	RecursiveIdentifier::Estimate autoTuneEstimate;
+};
+
+// Binary telemetry frames are streamed to any client connected to the
+// telemetry port, once per control loop iteration.  Frames are a fixed 40
+// bytes, all fields little-endian, floats are IEEE-754 single precision:
+//   Offset  Size  Field
+//   0       2     magic (0x5653)
+//   2       1     format version
+//   3       1     state (SousVide::State)
+//   4       4     sequence number (uint32, increments by one per frame)
+//   8       4     timestamp [msec] (uint32, monotonic, wraps after ~49 days)
+//   12      4     commanded temperature [deg F]
+//   16      4     actual temperature [deg F]
+//   20      4     PWM duty [-]
+//   24      4     proportional term [-]
+//   28      4     integral term [-]
+//   32      4     derivative term [-]
+//   36      4     feed-forward term [-]
+struct TelemetryFormat
+{
+	static const unsigned short magic = 0x5653;
+	static const unsigned char version = 1;
+	static const unsigned int frameSize = 40;// [bytes]
+};
+
+struct TelemetryMessage
+{
+	SousVide::State state;
+
+	double commandedTemperature;// [deg F]
+	double actualTemperature;// [deg F]
+	double pwmDuty;// [-]
+
+	// Contributions to PWM duty
+	double proportionalTerm;// [-]
+	double integralTerm;// [-]
+	double derivativeTerm;// [-]
+	double feedForwardTerm;// [-]
 };
 
 #endif// NETWORK_MESSAGE_DEFS_H_
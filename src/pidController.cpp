@@ -268,6 +268,11 @@ void PIDController::Reset(double reference, double value)
 	error = 0.0;
 	errorIntegral = value;
 
+	proportionalOutput = 0.0;
+	integralOutput = 0.0;
+	derivativeOutput = 0.0;
+	feedForwardOutput = 0.0;
+
 	errorDerivative.Reset(0.0);
 	commandDerivative.Reset(reference);
 }
@@ -303,7 +308,13 @@ double PIDController::Update(double reference, double feedback)
 		integralTerm = errorIntegral / ti;
 	}
 
-	double control = kp * (error + integralTerm + errorRate * kd) + commandRate * kf;
+	// Store the individual contributions for diagnostics
+	proportionalOutput = kp * error;
+	integralOutput = kp * integralTerm;
+	derivativeOutput = kp * errorRate * kd;
+	feedForwardOutput = commandRate * kf;
+
+	double control = proportionalOutput + integralOutput + derivativeOutput + feedForwardOutput;
 
 	if (fabs(highLimit - lowLimit) < nearlyZero)
 	{
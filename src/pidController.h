@@ -36,6 +36,12 @@ public:
 	double GetErrorRate(void) const;
 	double GetCommandRate(void) const;
 
+	// Contributions of each term to the most recent (unclamped) output
+	double GetProportionalOutput(void) const { return proportionalOutput; };
+	double GetIntegralOutput(void) const { return integralOutput; };
+	double GetDerivativeOutput(void) const { return derivativeOutput; };
+	double GetFeedForwardOutput(void) const { return feedForwardOutput; };
+
 protected:
 	static const double nearlyZero;
 
@@ -44,6 +50,7 @@ protected:
 	double kp, ti, kd, kf;
 	double error, errorIntegral;
 	double highLimit, lowLimit;
+	double proportionalOutput, integralOutput, derivativeOutput, feedForwardOutput;
 
 	DerivativeFilter errorDerivative;
 	DerivativeFilter commandDerivative;
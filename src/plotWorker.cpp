@@ -0,0 +1,487 @@
+// File:  plotWorker.cpp
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Copy:  (c) Copyright 2026
+// Desc:  Renders the temperature history plot on a dedicated thread, so that
+//        rendering and file I/O can not delay the control loop.  The control thread
+//        feeds samples, resets and redraw requests through a lock-free queue;
+//        none of the control thread methods ever block.  Redraw requests that
+//        arrive while one is still pending are coalesced into a single render.
+
+// Standard C++ headers
+#include <cassert>
+#include <cerrno>
+#include <cstring>
+#include <algorithm>
+
+// Local headers
+#include "plotWorker.h"
+#include "monotonicClock.h"
+#include "workerThread.h"
+
+//==========================================================================
+// Class:			PlotWorker
+// Function:		Constant definitions
+//
+// Description:		Constant definitions for PlotWorker class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+const unsigned int PlotWorker::queueSize = 4096;
+const unsigned int PlotWorker::plotBucketCount = 800;
+
+//==========================================================================
+// Class:			PlotWorker
+// Function:		PlotWorker
+//
+// Description:		Constructor for PlotWorker class.
+//
+// Input Arguments:
+//		outStream	= std::ostream&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+PlotWorker::PlotWorker(std::ostream &outStream) : outStream(outStream),
+	queue(queueSize), chart(outStream), commandedTemperature(plotBucketCount),
+	actualTemperature(plotBucketCount)
+{
+	sem_init(&wakeSemaphore, 0, 0);
+	workerRunning = false;
+	continueRunning = false;
+	redrawPending = false;
+	coalescedRedrawCount = 0;
+
+	plotActive = false;
+	renderedSampleCount = 0;
+	latestTime = 0.0;
+	yMin = 0.0;
+	yMax = 0.0;
+
+	// Allocate everything now, so the worker never has to
+	commandedTime.reserve(commandedTemperature.GetMaximumPointCount());
+	commandedValue.reserve(commandedTemperature.GetMaximumPointCount());
+	actualTime.reserve(actualTemperature.GetMaximumPointCount());
+	actualValue.reserve(actualTemperature.GetMaximumPointCount());
+
+	chart.SetTitle("Temperature History");
+	chart.SetXLabel("Time [min]");
+	chart.SetYLabel("Temperature [deg F]");
+	chart.AddSeries(commandedTime, commandedValue, "Commanded", "red");
+	chart.AddSeries(actualTime, actualValue, "Actual", "blue");
+}
+
+//==========================================================================
+// Class:			PlotWorker
+// Function:		~PlotWorker
+//
+// Description:		Destructor for PlotWorker class.  Stops the worker thread
+//					after it has processed everything that was queued.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+PlotWorker::~PlotWorker()
+{
+	continueRunning = false;
+	int errorNumber;
+	if (workerRunning)
+	{
+		sem_post(&wakeSemaphore);
+		if ((errorNumber = pthread_join(workerThread, NULL)) != 0)
+			outStream << "Error joining plot thread (" << errorNumber << ")" << std::endl;
+	}
+
+	FinishPlot();
+
+	if (sem_destroy(&wakeSemaphore) != 0)
+		outStream << "Error destroying semaphore:  " << strerror(errno) << std::endl;
+}
+
+//==========================================================================
+// Class:			friend of PlotWorker
+// Function:		LaunchPlotThread
+//
+// Description:		Plot thread entry point (launches member function).
+//
+// Input Arguments:
+//		pThisWorker =	void* (really a pointer to a PlotWorker)
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		void*
+//
+//==========================================================================
+void *LaunchPlotThread(void *pThisWorker)
+{
+	static_cast<PlotWorker*>(pThisWorker)->WorkerThreadEntry();
+	return NULL;
+}
+
+//==========================================================================
+// Class:			PlotWorker
+// Function:		Start
+//
+// Description:		Spawns the worker thread.  The new thread inherits the
+//					scheduling policy of the caller, so this should be called
+//					before the control thread enters real-time mode.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool PlotWorker::Start(void)
+{
+	assert(!workerRunning);
+
+	continueRunning = true;
+	int errorNumber;
+	if ((errorNumber = WorkerThread::Create(workerThread, &LaunchPlotThread, (void*)this)) == 0)
+	{
+		workerRunning = true;
+		return true;
+	}
+
+	outStream << "Failed to spawn plot thread (" << errorNumber << ")" << std::endl;
+	continueRunning = false;
+	return false;
+}
+
+//==========================================================================
+// Class:			PlotWorker
+// Function:		Reset
+//
+// Description:		Discards the current plot and starts a new one, written
+//					to the specified file.  Must only be called from the
+//					control thread.
+//
+// Input Arguments:
+//		outputFileName		= const std::string&
+//		initialTemperature	= const double& [deg F]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if the request was queued, false otherwise
+//
+//==========================================================================
+bool PlotWorker::Reset(const std::string &outputFileName,
+	const double &initialTemperature)
+{
+	PlotItem item;
+	item.type = PlotItem::TypeReset;
+	item.time = 0.0;
+	item.commandedTemperature = initialTemperature;
+	item.actualTemperature = initialTemperature;
+	item.outputFileName = outputFileName;
+
+	if (!queue.Push(item))
+		return false;
+
+	sem_post(&wakeSemaphore);
+	return true;
+}
+
+//==========================================================================
+// Class:			PlotWorker
+// Function:		AddSample
+//
+// Description:		Queues a new data point.  It will be drawn with the next
+//					redraw.  Must only be called from the control thread.
+//
+// Input Arguments:
+//		time					= const double& [min]
+//		commandedTemperature	= const double& [deg F]
+//		actualTemperature		= const double& [deg F]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if the sample was queued, false if the queue was full
+//
+//==========================================================================
+bool PlotWorker::AddSample(const double &time,
+	const double &commandedTemperature, const double &actualTemperature)
+{
+	PlotItem item;
+	item.type = PlotItem::TypeSample;
+	item.time = time;
+	item.commandedTemperature = commandedTemperature;
+	item.actualTemperature = actualTemperature;
+
+	// No need to wake the worker - the sample is picked up with the next redraw
+	return queue.Push(item);
+}
+
+//==========================================================================
+// Class:			PlotWorker
+// Function:		RequestRedraw
+//
+// Description:		Asks the worker to redraw the plot with all samples queued
+//					so far.  If a previous request has not yet been picked up,
+//					this request is merged with it.  Must only be called from
+//					the control thread.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void PlotWorker::RequestRedraw(void)
+{
+	if (redrawPending)
+	{
+		coalescedRedrawCount++;
+		return;
+	}
+
+	redrawPending = true;
+	sem_post(&wakeSemaphore);
+}
+
+//==========================================================================
+// Class:			PlotWorker
+// Function:		WorkerThreadEntry
+//
+// Description:		Main loop for the worker thread.  Sleeps until woken by a
+//					reset or redraw request (or shutdown), then processes the
+//					queue and renders at most once.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void PlotWorker::WorkerThreadEntry(void)
+{
+	bool redraw;
+	while (true)
+	{
+		if (sem_wait(&wakeSemaphore) != 0)
+		{
+			if (errno == EINTR)
+				continue;
+			outStream << "Plot thread failed to wait for requests:  " << strerror(errno) << std::endl;
+			break;
+		}
+
+		// Clear the flag before draining the queue, so any request made after
+		// this point results in another render
+		redraw = redrawPending;
+		if (redraw)
+			redrawPending = false;
+		__sync_synchronize();
+
+		ProcessQueue();
+
+		if (!continueRunning)
+			break;
+
+		if (redraw)
+			Render();
+	}
+}
+
+//==========================================================================
+// Class:			PlotWorker
+// Function:		ProcessQueue
+//
+// Description:		Removes all items from the queue, adding samples to the
+//					data to be plotted and acting on reset requests.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void PlotWorker::ProcessQueue(void)
+{
+	PlotItem item;
+	while (queue.Pop(item))
+	{
+		if (item.type == PlotItem::TypeReset)
+			StartPlot(item.outputFileName, item.actualTemperature);
+		else
+			AddToPlot(item);
+	}
+}
+
+//==========================================================================
+// Class:			PlotWorker
+// Function:		StartPlot
+//
+// Description:		Finishes any previous plot and discards its data.
+//
+// Input Arguments:
+//		fileName			= const std::string&
+//		initialTemperature	= const double& [deg F]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void PlotWorker::StartPlot(const std::string &fileName,
+	const double &initialTemperature)
+{
+	FinishPlot();
+
+	outputFileName = fileName;
+	plotActive = true;
+
+	commandedTemperature.Reset();
+	actualTemperature.Reset();
+	renderedSampleCount = 0;
+	latestTime = 0.0;
+
+	yMin = initialTemperature;
+	yMax = yMin;
+}
+
+//==========================================================================
+// Class:			PlotWorker
+// Function:		AddToPlot
+//
+// Description:		Adds a sample to the (downsampled) plot data.
+//
+// Input Arguments:
+//		sample	= const PlotItem&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void PlotWorker::AddToPlot(const PlotItem &sample)
+{
+	if (!plotActive)
+		return;
+
+	commandedTemperature.Add(sample.time, sample.commandedTemperature);
+	actualTemperature.Add(sample.time, sample.actualTemperature);
+
+	yMin = std::min(yMin, std::min(sample.commandedTemperature, sample.actualTemperature));
+	yMax = std::max(yMax, std::max(sample.commandedTemperature, sample.actualTemperature));
+	latestTime = sample.time;
+}
+
+//==========================================================================
+// Class:			PlotWorker
+// Function:		FinishPlot
+//
+// Description:		Renders the final image for the current plot and writes
+//					the render latency for the plot to the log.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void PlotWorker::FinishPlot(void)
+{
+	if (!plotActive)
+		return;
+
+	Render();
+	plotActive = false;
+
+	if (renderLatency.GetTotalCount() > 0)
+	{
+		outStream << "Plot render latency (" << coalescedRedrawCount
+			<< " redraw requests coalesced, " << queue.GetOverflowCount()
+			<< " items dropped):" << std::endl;
+		renderLatency.Print(outStream);
+		renderLatency.Reset();
+	}
+}
+
+//==========================================================================
+// Class:			PlotWorker
+// Function:		Render
+//
+// Description:		Writes the chart image, if any samples have arrived since
+//					it was last written.  The number of points drawn per
+//					series is bounded regardless of the length of the cook.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void PlotWorker::Render(void)
+{
+	if (!plotActive || actualTemperature.GetSampleCount() == renderedSampleCount)
+		return;
+
+	const double startTime(MonotonicClock::GetTime());
+	renderedSampleCount = actualTemperature.GetSampleCount();
+
+	commandedTemperature.GetSeries(commandedTime, commandedValue);
+	actualTemperature.GetSeries(actualTime, actualValue);
+
+	const double yPadding(std::max(0.05 * (yMax - yMin), 1.0));// [deg F]
+	chart.SetXRange(0.0, latestTime);
+	chart.SetYRange(yMin - yPadding, yMax + yPadding);
+	if (!chart.Render(outputFileName))
+		return;
+
+	renderLatency.Add(MonotonicClock::GetElapsedTime(startTime));
+}
@@ -0,0 +1,106 @@
+// File:  plotWorker.h
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Copy:  (c) Copyright 2026
+// Desc:  Renders the temperature history plot on a dedicated thread, so that
+//        rendering and file I/O can not delay the control loop.  The control thread
+//        feeds samples, resets and redraw requests through a lock-free queue;
+//        none of the control thread methods ever block.  Redraw requests that
+//        arrive while one is still pending are coalesced into a single render.
+
+#ifndef PLOT_WORKER_H_
+#define PLOT_WORKER_H_
+
+// Standard C++ headers
+#include <string>
+#include <vector>
+#include <iostream>
+
+// *nix headers
+#include <pthread.h>
+#include <semaphore.h>
+
+// Local headers
+#include "spscQueue.h"
+#include "timingHistogram.h"
+#include "chartRenderer.h"
+#include "minMaxDownsampler.h"
+
+class PlotWorker
+{
+public:
+	PlotWorker(std::ostream &outStream = std::cout);
+	~PlotWorker();
+
+	bool Start(void);
+
+	// Control thread only
+	bool Reset(const std::string &outputFileName, const double &initialTemperature);
+	bool AddSample(const double &time, const double &commandedTemperature,
+		const double &actualTemperature);
+	void RequestRedraw(void);
+
+	unsigned long GetCoalescedRedrawCount(void) const { return coalescedRedrawCount; };
+	unsigned int GetDroppedItemCount(void) const { return queue.GetOverflowCount(); };
+
+private:
+	static const unsigned int queueSize;
+	static const unsigned int plotBucketCount;
+
+	std::ostream &outStream;
+
+	struct PlotItem
+	{
+		enum Type
+		{
+			TypeSample,
+			TypeReset
+		} type;
+
+		double time;// [min]
+		double commandedTemperature;// [deg F]
+		double actualTemperature;// [deg F]
+		std::string outputFileName;// Only used for TypeReset
+	};
+
+	SPSCQueue<PlotItem> queue;
+
+	sem_t wakeSemaphore;
+	pthread_t workerThread;
+	bool workerRunning;
+	volatile bool continueRunning;
+	volatile bool redrawPending;// Set by control thread, cleared by worker
+	volatile unsigned long coalescedRedrawCount;// Written only by control thread
+
+	friend void *LaunchPlotThread(void *pThisWorker);
+	void WorkerThreadEntry(void);
+
+	// Everything below here belongs to the worker thread
+	ChartRenderer chart;
+	bool plotActive;
+	std::string outputFileName;
+
+	// Each series is reduced to the extremes of a fixed number of buckets,
+	// so memory and render cost do not depend on the length of the cook
+	MinMaxDownsampler commandedTemperature, actualTemperature;
+	std::vector<double> commandedTime, commandedValue;// Output of downsampler
+	std::vector<double> actualTime, actualValue;// Output of downsampler
+	unsigned long renderedSampleCount;
+	double latestTime;// [min]
+	double yMin, yMax;// [deg F]
+
+	// Time from the start of a redraw until the image has been written
+	TimingHistogram renderLatency;
+
+	void ProcessQueue(void);
+	void StartPlot(const std::string &fileName, const double &initialTemperature);
+	void AddToPlot(const PlotItem &sample);
+	void FinishPlot(void);
+	void Render(void);
+
+	// Not copyable
+	PlotWorker(const PlotWorker &);
+	PlotWorker& operator=(const PlotWorker &);
+};
+
+#endif// PLOT_WORKER_H_
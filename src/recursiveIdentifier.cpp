@@ -0,0 +1,350 @@
+// File:  recursiveIdentifier.cpp
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Copy:  (c) Copyright 2026
+// Desc:  Online (recursive least-squares) identification of the heated tank
+//        model described in autoTuner.h.  Samples are added one at a time while
+//        auto-tuning, so estimates of c1, c2, tau and ambient temperature
+//        (with standard deviations) are available throughout the experiment.
+//        The regression is the same one AutoTuner performs on the complete
+//        data set.  Since tau enters the model non-linearly, one RLS filter is
+//        run for each tau on a fixed logarithmic grid; the filter with the
+//        smallest sum of squared residuals gives the estimate, and tau is
+//        refined by interpolating between neighboring grid points.  No memory
+//        is allocated, so this is safe to use in the control loop.
+
+// Standard C++ headers
+#include <cmath>
+
+// Local headers
+#include "recursiveIdentifier.h"
+#include "autoTuner.h"
+
+//==========================================================================
+// Class:			RecursiveIdentifier
+// Function:		Constant definitions
+//
+// Description:		Constant definitions for RecursiveIdentifier class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+const unsigned int RecursiveIdentifier::tauCount;
+const unsigned int RecursiveIdentifier::parameterCount;
+const double RecursiveIdentifier::minimumTau(0.5);// [sec]
+const double RecursiveIdentifier::maximumTau(500.0);// [sec]
+const double RecursiveIdentifier::initialCovariance(1.0e6);
+const unsigned int RecursiveIdentifier::stableSampleCount(30);
+
+//==========================================================================
+// Class:			RecursiveIdentifier
+// Function:		RecursiveIdentifier
+//
+// Description:		Constructor for RecursiveIdentifier class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+RecursiveIdentifier::RecursiveIdentifier()
+{
+	Reset();
+}
+
+//==========================================================================
+// Class:			RecursiveIdentifier
+// Function:		Reset
+//
+// Description:		Discards all samples and estimates.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void RecursiveIdentifier::Reset(void)
+{
+	const double tauRatio(pow(maximumTau / minimumTau, 1.0 / (tauCount - 1)));
+
+	unsigned int i, j, k;
+	for (i = 0; i < tauCount; i++)
+	{
+		Filter &filter(filters[i]);
+		filter.tau = minimumTau * pow(tauRatio, static_cast<double>(i));
+		filter.heatState = 0.0;
+		filter.sumSquaredResiduals = 0.0;
+
+		for (j = 0; j < parameterCount; j++)
+		{
+			filter.theta[j] = 0.0;
+			for (k = 0; k < parameterCount; k++)
+				filter.covariance[j][k] = j == k ? initialCovariance : 0.0;
+		}
+	}
+
+	bestIndex = 0;
+	samplesSinceBestChanged = 0;
+	sampleCount = 0;
+	hasPreviousSample = false;
+}
+
+//==========================================================================
+// Class:			RecursiveIdentifier
+// Function:		Add
+//
+// Description:		Adds a sample.  The rate of change of temperature between
+//					this sample and the previous one is regressed against the
+//					state at the previous sample (as in AutoTuner).
+//
+// Input Arguments:
+//		time		= const double&, since start of auto-tuning [sec]
+//		temperature	= const double& [deg F]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void RecursiveIdentifier::Add(const double &time, const double &temperature)
+{
+	if (!hasPreviousSample)
+	{
+		initialTemperature = temperature;
+		previousTime = time;
+		previousTemperature = temperature;
+		hasPreviousSample = true;
+		return;
+	}
+
+	const double deltaTime(time - previousTime);
+	if (deltaTime <= 0.0)
+		return;
+
+	const double temperatureRate((temperature - previousTemperature) / deltaTime);
+	const double control(AutoTuner::GetControlSignal(previousTime));
+
+	double phi[parameterCount] = { 1.0, initialTemperature - previousTemperature, 0.0 };
+	unsigned int i, newBestIndex(0);
+	for (i = 0; i < tauCount; i++)
+	{
+		Filter &filter(filters[i]);
+		phi[2] = filter.heatState;
+		Update(filter, phi, temperatureRate);
+		filter.heatState += deltaTime * (control - filter.heatState) / filter.tau;
+
+		if (filter.sumSquaredResiduals < filters[newBestIndex].sumSquaredResiduals)
+			newBestIndex = i;
+	}
+
+	if (newBestIndex == bestIndex)
+		samplesSinceBestChanged++;
+	else
+	{
+		bestIndex = newBestIndex;
+		samplesSinceBestChanged = 0;
+	}
+
+	sampleCount++;
+	previousTime = time;
+	previousTemperature = temperature;
+}
+
+//==========================================================================
+// Class:			RecursiveIdentifier
+// Function:		Update
+//
+// Description:		Standard recursive least-squares update (no forgetting -
+//					the model is time-invariant).  Also accumulates the sum of
+//					squared residuals of the least-squares solution.
+//
+// Input Arguments:
+//		filter	= Filter&
+//		phi		= const double*, regressors
+//		y		= const double&, measurement
+//
+// Output Arguments:
+//		filter	= Filter&
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void RecursiveIdentifier::Update(Filter &filter, const double *phi,
+	const double &y)
+{
+	double pPhi[parameterCount];
+	double denominator(1.0), error(y);
+	unsigned int i, j;
+	for (i = 0; i < parameterCount; i++)
+	{
+		pPhi[i] = 0.0;
+		for (j = 0; j < parameterCount; j++)
+			pPhi[i] += filter.covariance[i][j] * phi[j];
+
+		denominator += phi[i] * pPhi[i];
+		error -= phi[i] * filter.theta[i];
+	}
+
+	for (i = 0; i < parameterCount; i++)
+	{
+		filter.theta[i] += pPhi[i] * error / denominator;
+		for (j = 0; j < parameterCount; j++)
+			filter.covariance[i][j] -= pPhi[i] * pPhi[j] / denominator;
+	}
+
+	filter.sumSquaredResiduals += error * error / denominator;
+}
+
+//==========================================================================
+// Class:			RecursiveIdentifier
+// Function:		GetEstimate
+//
+// Description:		Returns the current parameter estimates.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		estimate	= Estimate&
+//
+// Return Value:
+//		bool, true if there are enough samples for an estimate, false otherwise
+//
+//==========================================================================
+bool RecursiveIdentifier::GetEstimate(Estimate &estimate) const
+{
+	if (sampleCount <= parameterCount)
+		return false;
+
+	const Filter &filter(filters[bestIndex]);
+	estimate.c1 = filter.theta[1];
+	estimate.c2 = filter.theta[2];
+	estimate.tau = GetRefinedTau();
+	estimate.ambientTemperature = filter.theta[0] / filter.theta[1] + initialTemperature;
+	GetStandardDeviations(filter, estimate.c1StandardDeviation,
+		estimate.c2StandardDeviation);
+	estimate.sampleCount = sampleCount;
+
+	return true;
+}
+
+//==========================================================================
+// Class:			RecursiveIdentifier
+// Function:		IsConverged
+//
+// Description:		Checks whether the estimates are good enough to stop
+//					collecting data.
+//
+// Input Arguments:
+//		tolerance	= const double&, maximum standard deviation of c1 and c2,
+//					  as a fraction of their values [-]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool
+//
+//==========================================================================
+bool RecursiveIdentifier::IsConverged(const double &tolerance) const
+{
+	if (sampleCount <= parameterCount || samplesSinceBestChanged < stableSampleCount)
+		return false;
+
+	const Filter &filter(filters[bestIndex]);
+	const double &c1(filter.theta[1]);
+	const double &c2(filter.theta[2]);
+	if (c1 <= 0.0 || c2 <= 0.0)
+		return false;
+
+	double c1StdDev, c2StdDev;
+	GetStandardDeviations(filter, c1StdDev, c2StdDev);
+	return c1StdDev <= tolerance * c1 && c2StdDev <= tolerance * c2;
+}
+
+//==========================================================================
+// Class:			RecursiveIdentifier
+// Function:		GetRefinedTau
+//
+// Description:		Fits a parabola to the sum of squared residuals vs. log(tau)
+//					at the best grid point and its neighbors, and returns the
+//					tau at the minimum.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		double [sec]
+//
+//==========================================================================
+double RecursiveIdentifier::GetRefinedTau(void) const
+{
+	if (bestIndex == 0 || bestIndex == tauCount - 1)
+		return filters[bestIndex].tau;
+
+	const double &below(filters[bestIndex - 1].sumSquaredResiduals);
+	const double &best(filters[bestIndex].sumSquaredResiduals);
+	const double &above(filters[bestIndex + 1].sumSquaredResiduals);
+	const double curvature(below - 2.0 * best + above);
+	if (curvature <= 0.0)
+		return filters[bestIndex].tau;
+
+	// Offset from the best point, in grid steps (at most half a step)
+	double offset(0.5 * (below - above) / curvature);
+	if (offset > 0.5)
+		offset = 0.5;
+	else if (offset < -0.5)
+		offset = -0.5;
+
+	const double logStep(log(filters[1].tau / filters[0].tau));
+	return filters[bestIndex].tau * exp(offset * logStep);
+}
+
+//==========================================================================
+// Class:			RecursiveIdentifier
+// Function:		GetStandardDeviations
+//
+// Description:		Computes the standard deviations of the estimates of c1 and
+//					c2 (from the residual variance and the RLS covariance).
+//
+// Input Arguments:
+//		filter	= const Filter&
+//
+// Output Arguments:
+//		c1StdDev	= double& [1/sec]
+//		c2StdDev	= double& [deg F/BTU]
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void RecursiveIdentifier::GetStandardDeviations(const Filter &filter,
+	double &c1StdDev, double &c2StdDev) const
+{
+	const double variance(filter.sumSquaredResiduals / (sampleCount - parameterCount));
+	c1StdDev = sqrt(variance * fabs(filter.covariance[1][1]));
+	c2StdDev = sqrt(variance * fabs(filter.covariance[2][2]));
+}
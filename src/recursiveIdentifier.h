@@ -0,0 +1,85 @@
+// File:  recursiveIdentifier.h
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Copy:  (c) Copyright 2026
+// Desc:  Online (recursive least-squares) identification of the heated tank
+//        model described in autoTuner.h.  Samples are added one at a time while
+//        auto-tuning, so estimates of c1, c2, tau and ambient temperature
+//        (with standard deviations) are available throughout the experiment.
+//        The regression is the same one AutoTuner performs on the complete
+//        data set.  Since tau enters the model non-linearly, one RLS filter is
+//        run for each tau on a fixed logarithmic grid; the filter with the
+//        smallest sum of squared residuals gives the estimate, and tau is
+//        refined by interpolating between neighboring grid points.  No memory
+//        is allocated, so this is safe to use in the control loop.
+
+#ifndef RECURSIVE_IDENTIFIER_H_
+#define RECURSIVE_IDENTIFIER_H_
+
+class RecursiveIdentifier
+{
+public:
+	RecursiveIdentifier();
+
+	void Reset(void);
+
+	// time is measured from the start of auto-tuning (it is used to look up
+	// the control signal)
+	void Add(const double &time, const double &temperature);
+
+	struct Estimate
+	{
+		double c1;// [1/sec]
+		double c2;// [deg F/BTU]
+		double tau;// [sec]
+		double ambientTemperature;// [deg F]
+
+		double c1StandardDeviation;// [1/sec]
+		double c2StandardDeviation;// [deg F/BTU]
+
+		unsigned int sampleCount;
+	};
+
+	bool GetEstimate(Estimate &estimate) const;
+
+	// True when the estimates of c1 and c2 are known to within the specified
+	// fraction (one standard deviation) and the best tau has stopped changing
+	bool IsConverged(const double &tolerance) const;
+
+private:
+	static const unsigned int tauCount = 20;
+	static const double minimumTau;// [sec]
+	static const double maximumTau;// [sec]
+	static const double initialCovariance;
+	static const unsigned int stableSampleCount;
+
+	static const unsigned int parameterCount = 3;
+
+	// Parameters are [c1 * (Tamb - T0), c1, c2], where T0 is the first
+	// temperature (keeping the regressors small improves conditioning)
+	struct Filter
+	{
+		double tau;// [sec]
+		double heatState;// [-]
+		double theta[parameterCount];
+		double covariance[parameterCount][parameterCount];
+		double sumSquaredResiduals;
+	};
+
+	Filter filters[tauCount];
+	unsigned int bestIndex;
+	unsigned int samplesSinceBestChanged;
+	unsigned int sampleCount;
+
+	bool hasPreviousSample;
+	double previousTime;// [sec]
+	double previousTemperature;// [deg F]
+	double initialTemperature;// [deg F]
+
+	static void Update(Filter &filter, const double *phi, const double &y);
+	double GetRefinedTau(void) const;
+	void GetStandardDeviations(const Filter &filter, double &c1StdDev,
+		double &c2StdDev) const;
+};
+
+#endif// RECURSIVE_IDENTIFIER_H_
@@ -0,0 +1,308 @@
+// File:  smallMatrix.h
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Copy:  (c) Copyright 2026
+// Desc:  Matrix with dimensions fixed at compile time.  Elements are stored in
+//        the object itself (row-major), so SmallMatrix objects and the results
+//        of arithmetic on them never use the heap.  Intended for small systems
+//        evaluated many times (e.g. stepping a state-space model); use Matrix
+//        for large or variable-size problems.
+
+#ifndef SMALL_MATRIX_H_
+#define SMALL_MATRIX_H_
+
+// Standard C++ headers
+#include <cassert>
+#include <ostream>
+
+template <unsigned int R, unsigned int C>
+class SmallMatrix
+{
+public:
+	// Constructor (elements are zeroed)
+	SmallMatrix() { Zero(); };
+
+	// Make all elements zero
+	void Zero(void);
+
+	// Retrieve properties of this matrix
+	static unsigned int GetNumberOfRows(void) { return R; };
+	static unsigned int GetNumberOfColumns(void) { return C; };
+
+	// Operators
+	SmallMatrix& operator+=(const SmallMatrix &target);
+	SmallMatrix& operator-=(const SmallMatrix &target);
+	SmallMatrix& operator*=(const double &target);
+	const SmallMatrix operator+(const SmallMatrix &target) const;
+	const SmallMatrix operator-(const SmallMatrix &target) const;
+	const SmallMatrix operator*(const double &target) const;
+	template <unsigned int C2>
+	const SmallMatrix<R, C2> operator*(const SmallMatrix<C, C2> &target) const;
+
+	double &operator()(const unsigned int &row, const unsigned int &column)
+	{
+		assert(row < R && column < C);
+		return elements[row * C + column];
+	};
+
+	const double &operator()(const unsigned int &row, const unsigned int &column) const
+	{
+		assert(row < R && column < C);
+		return elements[row * C + column];
+	};
+
+private:
+	double elements[R * C];
+};
+
+//==========================================================================
+// Class:			SmallMatrix
+// Function:		Zero
+//
+// Description:		Sets all elements of this matrix to zero.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+template <unsigned int R, unsigned int C>
+void SmallMatrix<R, C>::Zero(void)
+{
+	unsigned int i;
+	for (i = 0; i < R * C; i++)
+		elements[i] = 0.0;
+}
+
+//==========================================================================
+// Class:			SmallMatrix
+// Function:		operator +=
+//
+// Description:		Addition assignment operator for the SmallMatrix class.
+//
+// Input Arguments:
+//		target	= const SmallMatrix& to add
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		SmallMatrix& result of the addition
+//
+//==========================================================================
+template <unsigned int R, unsigned int C>
+SmallMatrix<R, C>& SmallMatrix<R, C>::operator+=(const SmallMatrix &target)
+{
+	unsigned int i;
+	for (i = 0; i < R * C; i++)
+		elements[i] += target.elements[i];
+
+	return *this;
+}
+
+//==========================================================================
+// Class:			SmallMatrix
+// Function:		operator -=
+//
+// Description:		Subtraction assignment operator for the SmallMatrix class.
+//
+// Input Arguments:
+//		target	= const SmallMatrix& to subtract
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		SmallMatrix& result of the subtraction
+//
+//==========================================================================
+template <unsigned int R, unsigned int C>
+SmallMatrix<R, C>& SmallMatrix<R, C>::operator-=(const SmallMatrix &target)
+{
+	unsigned int i;
+	for (i = 0; i < R * C; i++)
+		elements[i] -= target.elements[i];
+
+	return *this;
+}
+
+//==========================================================================
+// Class:			SmallMatrix
+// Function:		operator *=
+//
+// Description:		Element-wise multiplication assignment operator for the
+//					SmallMatrix class.
+//
+// Input Arguments:
+//		target	= const double& to multiply by
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		SmallMatrix& result of the multiplication
+//
+//==========================================================================
+template <unsigned int R, unsigned int C>
+SmallMatrix<R, C>& SmallMatrix<R, C>::operator*=(const double &target)
+{
+	unsigned int i;
+	for (i = 0; i < R * C; i++)
+		elements[i] *= target;
+
+	return *this;
+}
+
+//==========================================================================
+// Class:			SmallMatrix
+// Function:		operator +
+//
+// Description:		Addition operator for the SmallMatrix class.
+//
+// Input Arguments:
+//		target	= const SmallMatrix& to add
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		const SmallMatrix containing the result of the addition
+//
+//==========================================================================
+template <unsigned int R, unsigned int C>
+const SmallMatrix<R, C> SmallMatrix<R, C>::operator+(const SmallMatrix &target) const
+{
+	SmallMatrix result(*this);
+	result += target;
+	return result;
+}
+
+//==========================================================================
+// Class:			SmallMatrix
+// Function:		operator -
+//
+// Description:		Subtraction operator for the SmallMatrix class.
+//
+// Input Arguments:
+//		target	= const SmallMatrix& to subtract
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		const SmallMatrix containing the result of the subtraction
+//
+//==========================================================================
+template <unsigned int R, unsigned int C>
+const SmallMatrix<R, C> SmallMatrix<R, C>::operator-(const SmallMatrix &target) const
+{
+	SmallMatrix result(*this);
+	result -= target;
+	return result;
+}
+
+//==========================================================================
+// Class:			SmallMatrix
+// Function:		operator *
+//
+// Description:		Element-wise multiplication operator for the SmallMatrix
+//					class.
+//
+// Input Arguments:
+//		target	= const double& to multiply by
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		const SmallMatrix containing the result of the multiplication
+//
+//==========================================================================
+template <unsigned int R, unsigned int C>
+const SmallMatrix<R, C> SmallMatrix<R, C>::operator*(const double &target) const
+{
+	SmallMatrix result(*this);
+	result *= target;
+	return result;
+}
+
+//==========================================================================
+// Class:			SmallMatrix
+// Function:		operator *
+//
+// Description:		Multiplication operator for the SmallMatrix class.  The
+//					inner dimensions are checked by the compiler.
+//
+// Input Arguments:
+//		target	= const SmallMatrix<C, C2>& to multiply by
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		const SmallMatrix<R, C2> containing the result of the multiplication
+//
+//==========================================================================
+template <unsigned int R, unsigned int C>
+template <unsigned int C2>
+const SmallMatrix<R, C2> SmallMatrix<R, C>::operator*(
+	const SmallMatrix<C, C2> &target) const
+{
+	SmallMatrix<R, C2> result;// Zeroed by constructor
+
+	unsigned int i, j, k;
+	for (i = 0; i < R; i++)
+	{
+		for (k = 0; k < C; k++)
+		{
+			const double factor(elements[i * C + k]);
+			for (j = 0; j < C2; j++)
+				result(i,j) += factor * target(k,j);
+		}
+	}
+
+	return result;
+}
+
+//==========================================================================
+// Class:			None
+// Function:		operator<<
+//
+// Description:		Overload of outstream operator.
+//
+// Input Arguments:
+//		o	= std::ostream&
+//		m	= const SmallMatrix&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		std::ostream&
+//
+//==========================================================================
+template <unsigned int R, unsigned int C>
+std::ostream& operator<<(std::ostream &o, const SmallMatrix<R, C> &m)
+{
+	unsigned int i, j;
+	for (i = 0; i < R; i++)
+	{
+		if (i > 0)
+			o << "\n";
+		for (j = 0; j < C; j++)
+		{
+			if (j > 0)
+				o << "\t";
+			o << m(i,j);
+		}
+	}
+
+	return o;
+}
+
+#endif// SMALL_MATRIX_H_
@@ -15,9 +15,13 @@
 #include <fstream>
 #include <cmath>
 #include <cstdio>
+#include <cstring>
+#include <cerrno>
 
 // *nix standard headers
 #include <unistd.h>
+#include <sched.h>
+#include <sys/mman.h>
 
 // Local headers
 #include "sousVide.h"
@@ -25,7 +29,11 @@
 #include "temperatureController.h"
 #include "networkMessageDefs.h"
 #include "autoTuner.h"
-#include "gnuPlotter.h"
+#include "plotWorker.h"
+#include "asyncLogBuffer.h"
+#include "binaryLogWriter.h"
+#include "mappedLogReader.h"
+#include "monotonicClock.h"
 #include "sousVideConfig.h"
 #include "rpi/gpio.h"
 #include "rpi/pwmOutput.h"
@@ -96,7 +104,11 @@ int main(int argc, char *argv[])
 //==========================================================================
 const std::string SousVide::configFileName = "sousVide.rc";
 const std::string SousVide::autoTuneLogName = "autoTune.log";
-const std::string SousVide::plotFileName = "temperaturePlot.png";
+const std::string SousVide::plotFileName = "temperaturePlot.svg";
+const unsigned int SousVide::plotRedrawInterval = 10;
+const unsigned int SousVide::stackPrefaultSize = 64 * 1024;
+const unsigned int SousVide::historySize = 8192;
+const unsigned int SousVide::autoTuneReportInterval = 10;
 
 //==========================================================================
 // Class:			SousVide
@@ -114,7 +126,8 @@ const std::string SousVide::plotFileName = "temperaturePlot.png";
 //		None
 //
 //==========================================================================
-SousVide::SousVide(bool autoTune)
+SousVide::SousVide(bool autoTune) : loopStatistics(StateCount),
+	history(historySize)
 {
 	// Set up the logger first, so we can use it right away
 	// We do add a file sink later (in Initialize() because it can fail)
@@ -151,9 +164,11 @@ SousVide::~SousVide()
 	delete ni;
 	delete controller;
 	delete pumpRelay;
-	delete plotter;
+	delete plotWorker;
 
 	CleanUpTimeHistoryLog();
+	delete thLogStream;
+	delete thLogBuffer;
 
 	logFile.close();
 
@@ -197,6 +212,7 @@ bool SousVide::Initialize(void)
 	}
 
 	loopTimer = new TimingUtility(1.0 / configuration->system.idleFrequency, logger);
+	loopPeriod = 1.0 / configuration->system.idleFrequency;
 
 	std::string sensorID(configuration->io.sensorID);
 	if (sensorID.empty())
@@ -236,12 +252,131 @@ bool SousVide::Initialize(void)
 	}
 
 	thLog = NULL;
-	thLogFile = NULL;
-	plotter = NULL;
+	cookLog = NULL;
+	thLogBuffer = new AsyncLogBuffer(logger);
+	thLogStream = new std::ostream(thLogBuffer);
+	if (!thLogBuffer->Start())
+	{
+		logger << "Failed to start log writer thread.  Exiting..." << std::endl;
+		return false;
+	}
+	plotSamplesSinceRedraw = 0;
+	plotWorker = new PlotWorker(logger);
+	if (!plotWorker->Start())
+		logger << "Warning:  Failed to start plot thread; temperature plot will not be updated" << std::endl;
+
+	// Do this last, so other threads we created (i.e. for sockets) are not
+	// affected
+	if (configuration->system.realTimePriority > 0 || configuration->system.cpuAffinity >= 0)
+	{
+		if (!EnableRealTimeMode())
+			logger << "Warning:  Failed to enable real-time mode; continuing without it" << std::endl;
+	}
 
 	return true;
 }
 
+//==========================================================================
+// Class:			SousVide
+// Function:		EnableRealTimeMode
+//
+// Description:		Configures the calling thread for real-time operation
+//					according to the configuration file:  locks all memory
+//					to prevent page faults, pre-faults the stack, pins the
+//					thread to a CPU and switches to the SCHED_FIFO policy.
+//					Child processes do not inherit the real-time policy.
+//					Locking memory makes every thread stack resident, so the
+//					helper threads are created with small stacks (see
+//					WorkerThread).
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//==========================================================================
+bool SousVide::EnableRealTimeMode(void)
+{
+	bool ok(true);
+
+	if (configuration->system.realTimePriority > 0)
+	{
+		if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0)
+		{
+			logger << "Failed to lock memory:  " << strerror(errno) << std::endl;
+			ok = false;
+		}
+		else
+			PrefaultStack();
+	}
+
+	if (configuration->system.cpuAffinity >= 0)
+	{
+		cpu_set_t cpuSet;
+		CPU_ZERO(&cpuSet);
+		CPU_SET(configuration->system.cpuAffinity, &cpuSet);
+		if (sched_setaffinity(0, sizeof(cpuSet), &cpuSet) != 0)
+		{
+			logger << "Failed to set CPU affinity:  " << strerror(errno) << std::endl;
+			ok = false;
+		}
+		else
+			logger << "Control loop pinned to CPU " << configuration->system.cpuAffinity << std::endl;
+	}
+
+	if (configuration->system.realTimePriority > 0)
+	{
+		struct sched_param parameters;
+		parameters.sched_priority = configuration->system.realTimePriority;
+		int policy(SCHED_FIFO);
+#ifdef SCHED_RESET_ON_FORK
+		policy |= SCHED_RESET_ON_FORK;
+#endif
+		if (sched_setscheduler(0, policy, &parameters) != 0)
+		{
+			logger << "Failed to set SCHED_FIFO scheduling policy:  " << strerror(errno) << std::endl;
+			ok = false;
+		}
+		else
+			logger << "Control loop running with SCHED_FIFO priority "
+				<< configuration->system.realTimePriority << std::endl;
+	}
+
+	return ok;
+}
+
+//==========================================================================
+// Class:			SousVide
+// Function:		PrefaultStack
+//
+// Description:		Touches each page of a block of stack, so that (with
+//					memory locked) the stack will not page fault later.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void SousVide::PrefaultStack(void)
+{
+	volatile unsigned char stack[stackPrefaultSize];
+	const long pageSize(sysconf(_SC_PAGESIZE));
+
+	unsigned int i;
+	for (i = 0; i < stackPrefaultSize; i += pageSize)
+		stack[i] = 0;
+	(void)stack[0];
+}
+
 //==========================================================================
 // Class:			SousVide
 // Function:		PrintUsageInfo
@@ -288,6 +423,10 @@ void SousVide::Run()
 	}
 
 	FrontToBackMessage receivedMessage;
+	double loopStartTime(MonotonicClock::GetTime()), lastLoopStartTime;
+	double desiredPeriod;// [sec]
+	State loopState(state);
+	loopPeriodChanged = true;
 
 	while (true)
 	{
@@ -295,21 +434,42 @@ void SousVide::Run()
 		if (!loopTimer->TimeLoop())
 			logger << "Warning:  Main loop timing failed" << std::endl;
 
+		lastLoopStartTime = loopStartTime;
+		loopStartTime = MonotonicClock::GetTime();
+		if (loopPeriodChanged)
+			loopPeriodChanged = false;// First period after a change is not meaningful
+		else
+		{
+			jitterHistogram.Add(fabs(loopStartTime - lastLoopStartTime - loopPeriod));
+			loopStatistics.AddPeriod(loopState, loopStartTime - lastLoopStartTime);
+		}
+
+		// State and period may change below; attribute this iteration to the
+		// state in which it started
+		loopState = state;
+		desiredPeriod = loopPeriod;
+
 		errorMessage.clear();
 
 		// Do the core work for the application
-		if (ni->ReceiveData(receivedMessage))
+		while (ni->ReceiveData(receivedMessage))
 		{
 			ProcessMessage(receivedMessage);
 			sendClientMessage = true;
 		}
 		UpdateState();
+		RecordHistory(loopStartTime);
 		if (sendClientMessage)
 		{
 			if (!ni->SendData(AssembleMessage()))
 				logger << "Failed to send message to client(s)" << std::endl;
 			sendClientMessage = false;
 		}
+
+		ni->SendTelemetry(AssembleTelemetry());
+
+		loopStatistics.AddWorkTime(loopState,
+			MonotonicClock::GetTime() - loopStartTime, desiredPeriod);
 	}
 }
 
@@ -425,12 +585,11 @@ bool SousVide::SaturationTimeExceeded(void)
 	}
 	else if (!lastOutputSaturated)
 	{
-		saturationStartTime = time(NULL);
+		saturationStartTime = MonotonicClock::GetTime();
 		return false;
 	}
 
-	time_t now(time(NULL));
-	if (difftime(now, saturationStartTime) > configuration->system.interlock.maxSaturationTime)
+	if (MonotonicClock::GetElapsedTime(saturationStartTime) > configuration->system.interlock.maxSaturationTime)
 	{
 		logger << "INTERLOCK:  PWM output saturation time exceeded" << std::endl;
 		AppendToErrorMessage("INTERLOCK:  PWM output saturation time exceeded");
@@ -544,6 +703,13 @@ void SousVide::UpdateState(void)
 {
 	if (state != nextState)
 	{
+		// Make sure everything logged so far reaches the disk
+		if (cookLog)
+			cookLog->Flush();
+
+		if (thLog || cookLog)
+			thLogBuffer->RequestSync();
+
 		ExitState();
 		state = nextState;
 		EnterState();
@@ -571,7 +737,7 @@ void SousVide::UpdateState(void)
 void SousVide::EnterState(void)
 {
 	assert(state >= 0 && state < StateCount);
-	stateStartTime = time(NULL);
+	stateStartTime = MonotonicClock::GetTime();
 
 	sendClientMessage = true;
 
@@ -605,7 +771,7 @@ void SousVide::EnterState(void)
 			nextState = StateError;
 		}
 
-		loopTimer->SetLoopTime(1.0 / configuration->system.idleFrequency);
+		SetLoopFrequency(configuration->system.idleFrequency);
 	}
 	else if (state == StateReady)
 	{
@@ -613,6 +779,7 @@ void SousVide::EnterState(void)
 	else if (state == StateHeating)
 	{
 		ResetPlot();
+		history.Clear();
 
 		controller->Reset();
 		controller->SetPlateauTemperature(plateauTemperature);
@@ -633,12 +800,15 @@ void SousVide::EnterState(void)
 	else if (state == StateAutoTune)
 	{
 		ResetPlot();
+		history.Clear();
 
 		EnterActiveState();
 		SetUpAutoTuneLog();
 		
 		controller->SetOutputEnable(false);
 		startTemperature = controller->GetActualTemperature();
+		identifier.Reset();
+		autoTuneSamplesSinceReport = 0;
 		
 		logger << "Auto-tune will stop in "
 			<< configuration->system.maxAutoTuneTime / 60.0
@@ -681,9 +851,12 @@ void SousVide::ProcessState(void)
 		return;
 	}
 
-	// TODO:  When to call UpdatePlotFile()?
-	if (plotTime.size() > 10)
-		UpdatePlotFile();
+	// Rendering happens on the plot thread; this never blocks
+	if (plotSamplesSinceRedraw > plotRedrawInterval)
+	{
+		plotWorker->RequestRedraw();
+		plotSamplesSinceRedraw = 0;
+	}
 
 	if (state == StateOff)
 	{
@@ -709,9 +882,8 @@ void SousVide::ProcessState(void)
 	}
 	else if (state == StateHeating)
 	{
-		*thLog << controller->GetCommandedTemperature()
-			<< controller->GetActualTemperature()
-			<< controller->GetPWMDuty() << std::endl;
+		LogCookingData(controller->GetCommandedTemperature(),
+			controller->GetActualTemperature());
 
 		UpdatePlotData(controller->GetCommandedTemperature(),
 			controller->GetActualTemperature());
@@ -725,15 +897,13 @@ void SousVide::ProcessState(void)
 	}
 	else if (state == StateSoaking)
 	{
-		*thLog << controller->GetCommandedTemperature()
-			<< controller->GetActualTemperature()
-			<< controller->GetPWMDuty() << std::endl;
+		LogCookingData(controller->GetCommandedTemperature(),
+			controller->GetActualTemperature());
 
 		UpdatePlotData(controller->GetCommandedTemperature(),
 			controller->GetActualTemperature());
 
-		time_t now = time(NULL);
-		if (difftime(now, stateStartTime) > soakTime)
+		if (MonotonicClock::GetElapsedTime(stateStartTime) > soakTime)
 			nextState = StateCooling;
 
 		if (command == CmdStop)
@@ -744,9 +914,8 @@ void SousVide::ProcessState(void)
 		// Not sure this state is necessary, but could provide interesting
 		// information on heat transfer of unit to environment...
 
-		*thLog << controller->GetActualTemperature()
-			<< controller->GetActualTemperature()
-			<< controller->GetPWMDuty() << std::endl;
+		LogCookingData(controller->GetActualTemperature(),
+			controller->GetActualTemperature());
 
 		UpdatePlotData(controller->GetActualTemperature(),
 			controller->GetActualTemperature());
@@ -757,8 +926,7 @@ void SousVide::ProcessState(void)
 	}
 	else if (state == StateError)
 	{
-		time_t now = time(NULL);
-		if (difftime(now, stateStartTime) > configuration->system.interlock.minErrorTime &&
+		if (MonotonicClock::GetElapsedTime(stateStartTime) > configuration->system.interlock.minErrorTime &&
 			command == CmdReset)
 			nextState = StateInitializing;
 	}
@@ -769,17 +937,32 @@ void SousVide::ProcessState(void)
 		UpdatePlotData(controller->GetActualTemperature(),
 			controller->GetActualTemperature());
 
-		time_t now = time(NULL);
-		double autoTuneTime = difftime(now, stateStartTime);
+		double autoTuneTime = MonotonicClock::GetElapsedTime(stateStartTime);
+		identifier.Add(autoTuneTime, controller->GetActualTemperature());
 		controller->DirectlySetPWMDuty(
 			AutoTuner::GetControlSignal(autoTuneTime));
 
+		// Let the front end follow the estimates as they develop
+		if (++autoTuneSamplesSinceReport >= autoTuneReportInterval)
+		{
+			sendClientMessage = true;
+			autoTuneSamplesSinceReport = 0;
+		}
+
 		double minAutoTuneTime = AutoTuner::GetMinimumAutoTuneTime(configuration->system.idleFrequency);
 		assert(minAutoTuneTime < configuration->system.maxAutoTuneTime);
 		if ((autoTuneTime > configuration->system.maxAutoTuneTime ||
 			controller->GetActualTemperature() - startTemperature > configuration->system.maxAutoTuneTemperatureRise) &&
 			autoTuneTime > minAutoTuneTime)
 			nextState = StateInitializing;
+		else if (configuration->system.autoTuneConvergenceTolerance > 0.0 &&
+			autoTuneTime > minAutoTuneTime &&
+			identifier.IsConverged(configuration->system.autoTuneConvergenceTolerance))
+		{
+			logger << "Auto-tune model estimates have converged after "
+				<< autoTuneTime << " sec" << std::endl;
+			nextState = StateInitializing;
+		}
 
 		if (command == CmdStop)
 			nextState = StateCooling;
@@ -838,11 +1021,16 @@ void SousVide::ExitState(void)
 	else if (state == StateAutoTune)
 	{
 		ExitActiveState();
+		LogIdentifierEstimate();
 
-		std::vector<double> time, temp;
-		if (!CleanUpAutoTuneLog(time, temp))
+		// time and temp refer to the log's storage (no copies are made)
+		MappedLogReader log(logger);
+		if (!CleanUpAutoTuneLog(log))
 			return;
 
+		const DataSpan time(log.GetColumn(0));
+		const DataSpan temp(log.GetColumn(1));
+
 		AutoTuner tuner(logger);
 
 		if (tuner.ProcessAutoTuneData(time, temp))
@@ -868,6 +1056,7 @@ void SousVide::ExitState(void)
 			configuration->WriteConfiguration(configFileName, "maxHeatingRate", tuner.GetMaxHeatRate());
 			
 			std::vector<double> control, simTemp;
+			control.reserve(time.size());
 			unsigned int i;
 			for (i = 0; i < time.size(); i++)
 				control.push_back(AutoTuner::GetControlSignal(time[i]));
@@ -917,6 +1106,27 @@ void SousVide::ExitState(void)
 //
 //==========================================================================
 std::string SousVide::GetStateName(void) const
+{
+	return GetStateName(state);
+}
+
+//==========================================================================
+// Class:			SousVide
+// Function:		GetStateName
+//
+// Description:		Returns a string describing the specified state.
+//
+// Input Arguments:
+//		state	= const State&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		std::string
+//
+//==========================================================================
+std::string SousVide::GetStateName(const State &state)
 {
 	assert(state >= 0 && state < StateCount);
 
@@ -940,12 +1150,64 @@ std::string SousVide::GetStateName(void) const
 		assert(false);
 }
 
+//==========================================================================
+// Class:			SousVide
+// Function:		SetLoopFrequency
+//
+// Description:		Sets the rate at which the main loop runs.
+//
+// Input Arguments:
+//		frequency	= double [Hz]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void SousVide::SetLoopFrequency(double frequency)
+{
+	loopPeriod = 1.0 / frequency;
+	loopTimer->SetLoopTime(loopPeriod);
+	loopPeriodChanged = true;
+}
+
+//==========================================================================
+// Class:			SousVide
+// Function:		LogLoopStatistics
+//
+// Description:		Writes the loop jitter histogram (then resets it) and the
+//					loop statistics for the current state to the log.  The
+//					loop statistics are only reset on request from a client.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void SousVide::LogLoopStatistics(void)
+{
+	logger << "Main loop jitter (deviation from " << loopPeriod << " sec period):" << std::endl;
+	jitterHistogram.Print(logger);
+	jitterHistogram.Reset();
+
+	logger << "Main loop statistics while " << GetStateName() << ":" << std::endl;
+	loopStatistics.Print(logger, state);
+}
+
 //==========================================================================
 // Class:			SousVide
 // Function:		EnterActiveState
 //
 // Description:		Performs actions necessary to enter an active (i.e. pump
-//					and heater ON) state.
+//					and heater ON) state.  The jitter histogram is reset, so
+//					it only covers the time spent in this state.
 //
 // Input Arguments:
 //		None
@@ -959,7 +1221,8 @@ std::string SousVide::GetStateName(void) const
 //==========================================================================
 void SousVide::EnterActiveState(void)
 {
-	loopTimer->SetLoopTime(1.0 / configuration->system.activeFrequency);
+	SetLoopFrequency(configuration->system.activeFrequency);
+	jitterHistogram.Reset();
 	pumpRelay->SetOutput(true);
 	controller->SetOutputEnable(true);
 }
@@ -969,7 +1232,8 @@ void SousVide::EnterActiveState(void)
 // Function:		ExitActiveState
 //
 // Description:		Performs actions necessary when leaving an active (i.e. pump
-//					and heater ON) state.
+//					and heater ON) state, including logging the loop timing
+//					for the state.
 //
 // Input Arguments:
 //		None
@@ -983,7 +1247,8 @@ void SousVide::EnterActiveState(void)
 //==========================================================================
 void SousVide::ExitActiveState(void)
 {
-	loopTimer->SetLoopTime(1.0 / configuration->system.idleFrequency);
+	LogLoopStatistics();// Before the loop period changes
+	SetLoopFrequency(configuration->system.idleFrequency);
 	pumpRelay->SetOutput(false);
 	controller->SetOutputEnable(false);
 }
@@ -1048,6 +1313,21 @@ void SousVide::ProcessMessage(const FrontToBackMessage &receivedMessage)
 			<< "Received AUTOTUNE command, but system is not in ready state (state = "
 			<< GetStateName() << ")" << std::endl;
 	}
+	else if (receivedMessage.command == CmdGetLoopStatistics)
+	{
+		if (!ni->SendLoopStatistics(loopStatistics))
+			logger << "Failed to send loop statistics to client(s)" << std::endl;
+	}
+	else if (receivedMessage.command == CmdResetLoopStatistics)
+	{
+		logger << "Received RESET LOOP STATISTICS command" << std::endl;
+		loopStatistics.Reset();
+	}
+	else if (receivedMessage.command == CmdGetHistory)
+	{
+		if (!ni->SendHistory(history, receivedMessage))
+			logger << "Failed to send time history to client(s)" << std::endl;
+	}
 	else
 	{
 		logger << "Received unknown command from front end:  "
@@ -1080,6 +1360,75 @@ BackToFrontMessage SousVide::AssembleMessage(void) const
 	message.commandedTemperature = controller->GetCommandedTemperature();
 	message.actualTemperature = controller->GetActualTemperature();
 
+	message.hasAutoTuneEstimate = state == StateAutoTune &&
+		identifier.GetEstimate(message.autoTuneEstimate);
+	message.autoTuneConverged = message.hasAutoTuneEstimate &&
+		configuration->system.autoTuneConvergenceTolerance > 0.0 &&
+		identifier.IsConverged(configuration->system.autoTuneConvergenceTolerance);
+
+	return message;
+}
+
+//==========================================================================
+// Class:			SousVide
+// Function:		RecordHistory
+//
+// Description:		Adds the current controller state to the time history.
+//
+// Input Arguments:
+//		time	= const double& [sec]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void SousVide::RecordHistory(const double &time)
+{
+	TimeHistoryBuffer::Sample sample;
+	sample.time = time;
+	sample.commandedTemperature = controller->GetCommandedTemperature();
+	sample.actualTemperature = controller->GetActualTemperature();
+	sample.pwmDuty = controller->GetPWMDuty();
+	sample.proportionalTerm = controller->GetProportionalOutput();
+	sample.integralTerm = controller->GetIntegralOutput();
+	sample.derivativeTerm = controller->GetDerivativeOutput();
+	sample.feedForwardTerm = controller->GetFeedForwardOutput();
+	sample.state = state;
+
+	history.Add(sample);
+}
+
+//==========================================================================
+// Class:			SousVide
+// Function:		AssembleTelemetry
+//
+// Description:		Assembles the telemetry message to send to the client(s).
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		TelemetryMessage
+//
+//==========================================================================
+TelemetryMessage SousVide::AssembleTelemetry(void) const
+{
+	TelemetryMessage message;
+	message.state = state;
+	message.commandedTemperature = controller->GetCommandedTemperature();
+	message.actualTemperature = controller->GetActualTemperature();
+	message.pwmDuty = controller->GetPWMDuty();
+	message.proportionalTerm = controller->GetProportionalOutput();
+	message.integralTerm = controller->GetIntegralOutput();
+	message.derivativeTerm = controller->GetDerivativeOutput();
+	message.feedForwardTerm = controller->GetFeedForwardOutput();
+
 	return message;
 }
 
@@ -1118,6 +1467,7 @@ void SousVide::AppendToErrorMessage(std::string message)
 //
 // Input Arguments:
 //		activity	= const std::string& appended to file name
+//		extension	= const std::string&, including the '.'
 //
 // Output Arguments:
 //		None
@@ -1126,7 +1476,8 @@ void SousVide::AppendToErrorMessage(std::string message)
 //		std::string containing the file name
 //
 //==========================================================================
-std::string SousVide::GetLogFileName(const std::string &activity) const
+std::string SousVide::GetLogFileName(const std::string &activity,
+	const std::string &extension) const
 {
 	time_t now(time(NULL));
 	struct tm* timeInfo = localtime(&now);
@@ -1139,7 +1490,7 @@ std::string SousVide::GetLogFileName(const std::string &activity) const
 		<< std::setw(2) << timeInfo->tm_hour << "-"// Use dashes instead of colons so user can view logs on MSW
 		<< std::setw(2) << timeInfo->tm_min << "-"
 		<< std::setw(2) << timeInfo->tm_sec
-		<< " " << activity << ".log";
+		<< " " << activity << extension;
 
 	return timeStamp.str();
 }
@@ -1162,26 +1513,86 @@ std::string SousVide::GetLogFileName(const std::string &activity) const
 //
 //==========================================================================
 void SousVide::SetUpTimeHistoryLog(void)
+{
+	OpenTimeHistoryLog(GetLogFileName("cooking", ".svlog"));
+
+	// Size blocks so that each one covers about one flush interval
+	unsigned int recordsPerBlock(static_cast<unsigned int>(
+		configuration->system.activeFrequency * configuration->system.logFlushInterval));
+	if (recordsPerBlock < 1)
+		recordsPerBlock = 1;
+
+	cookLog = new BinaryLogWriter(*thLogStream, recordsPerBlock);
+	cookLog->AddColumn("Commanded Temperature", "deg F");
+	cookLog->AddColumn("Actual Temperature", "deg F");
+	cookLog->AddColumn("PWM Duty", "%");
+}
+
+//==========================================================================
+// Class:			SousVide
+// Function:		LogCookingData
+//
+// Description:		Adds a record to the cooking log.
+//
+// Input Arguments:
+//		commandedTemperature	= const double& [deg F]
+//		actualTemperature		= const double& [deg F]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void SousVide::LogCookingData(const double &commandedTemperature,
+	const double &actualTemperature)
+{
+	assert(cookLog);
+
+	const double values[] = { commandedTemperature, actualTemperature,
+		controller->GetPWMDuty() };
+	cookLog->AddRecord(MonotonicClock::GetElapsedTime(logStartTime), values);
+}
+
+//==========================================================================
+// Class:			SousVide
+// Function:		OpenTimeHistoryLog
+//
+// Description:		Closes any previously opened log and opens the specified
+//					file for the next time history log.
+//
+// Input Arguments:
+//		fileName	= const std::string&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void SousVide::OpenTimeHistoryLog(const std::string &fileName)
 {
 	CleanUpTimeHistoryLog();
 
-	thLogFile = new std::ofstream(GetLogFileName().c_str(), std::ios::out);
-	thLog = new TimeHistoryLog(*thLogFile);
+	if (!thLogBuffer->Open(fileName, configuration->system.logFlushInterval))
+		logger << "Warning:  Time history will not be logged" << std::endl;
 
-	thLog->AddColumn("Commanded Temperature", "deg F");
-	thLog->AddColumn("Actual Temperature", "deg F");
-	thLog->AddColumn("PWM Duty", "%");
+	thLogStream->clear();
+	logStartTime = MonotonicClock::GetTime();
 }
 
 //==========================================================================
 // Class:			SousVide
 // Function:		CleanUpTimeHistoryLog
 //
-// Description:		Closes and delete objects associated with the temperature
-//					time history log.
+// Description:		Deletes the temperature time history logs and closes the
+//					file.  Closing normally happens in the background.
 //
 // Input Arguments:
-//		None
+//		waitForWriter	= const bool&, true to wait until all data is written
+//						  and the file is closed
 //
 // Output Arguments:
 //		None
@@ -1190,16 +1601,17 @@ void SousVide::SetUpTimeHistoryLog(void)
 //		None
 //
 //==========================================================================
-void SousVide::CleanUpTimeHistoryLog(void)
+void SousVide::CleanUpTimeHistoryLog(const bool &waitForWriter)
 {
-	if (thLog)
-		delete thLog;
+	delete thLog;
+	thLog = NULL;
 
-	if (thLogFile)
-	{
-		thLogFile->close();
-		delete thLogFile;
-	}
+	// Writes out the last partial block
+	delete cookLog;
+	cookLog = NULL;
+
+	if (thLogBuffer)
+		thLogBuffer->Close(waitForWriter);
 }
 
 //==========================================================================
@@ -1221,11 +1633,11 @@ void SousVide::CleanUpTimeHistoryLog(void)
 //==========================================================================
 void SousVide::SetUpAutoTuneLog(void)
 {
-	assert(!thLogFile);
+	assert(!thLog);
 
-	thLogFile = new std::ofstream(autoTuneLogName.c_str(), std::ios::out);
-	thLog = new TimeHistoryLog(*thLogFile);
+	OpenTimeHistoryLog(autoTuneLogName);
 
+	thLog = new TimeHistoryLog(*thLogStream);
 	thLog->AddColumn("Actual Temperature", "deg F");
 }
 
@@ -1234,68 +1646,29 @@ void SousVide::SetUpAutoTuneLog(void)
 // Function:		CleanUpAutoTuneLog
 //
 // Description:		Closes and delete objects associated with the temperature
-//					time history log (after it was set up for autotuning).
+//					time history log (after it was set up for autotuning), and
+//					reads the log back.
 //
 // Input Arguments:
 //		None
 //
 // Output Arguments:
-//		time		= std::vector<double>& [sec]
-//		temperature	= std::vector<double>& [deg F]
+//		log	= MappedLogReader&, column 0 is time [sec] and column 1 is
+//			  temperature [deg F]
 //
 // Return Value:
 //		bool, true for success, false otherwise
 //
 //==========================================================================
-bool SousVide::CleanUpAutoTuneLog(std::vector<double> &time,
-	std::vector<double> &temperature)
+bool SousVide::CleanUpAutoTuneLog(MappedLogReader &log)
 {
 	assert(thLog);
 
-	thLogFile->close();
-	delete thLogFile;
+	// We read the file back right away, so wait until it has been written
+	CleanUpTimeHistoryLog(true);
 
-	std::ifstream file(autoTuneLogName.c_str(), std::ios::in);
-	if (!file.is_open() || !file.good())
-	{
-		logger << "Failed to open '"
-			<< autoTuneLogName << "' for input" << std::endl;
+	if (!log.Read(autoTuneLogName, 2))
 		return false;
-	}
-
-	std::string line;
-
-	// Disregard first two lines (column title and units)
-	std::getline(file, line);
-	std::getline(file, line);
-
-	double value;
-	std::stringstream ss;
-	while (std::getline(file, line))
-	{
-		ss.clear();// clear stream state (otherwise we get stuck on EOL after first line)
-		ss.str(line);
-		if (!(ss >> value))
-		{
-			logger << "Failed to extract time value" << std::endl;
-			return false;
-		}
-		time.push_back(value);
-		if (ss.peek() != ',')
-		{
-			logger << "Expected ',', found '" << ss.peek() << "'" << std::endl;
-			return false;
-		}
-		ss.ignore();
-		if (!(ss >> value))
-		{
-			logger << "Failed to extract temperature value" << std::endl;
-			return false;
-		}
-		temperature.push_back(value);
-	}
-
-	file.close();
 
 	std::string newName(GetLogFileName("auto-tune"));
 	if (rename(autoTuneLogName.c_str(), newName.c_str()) != 0)
@@ -1307,9 +1680,10 @@ bool SousVide::CleanUpAutoTuneLog(std::vector<double> &time,
 
 //==========================================================================
 // Class:			SousVide
-// Function:		ResetPlot
+// Function:		LogIdentifierEstimate
 //
-// Description:		Resets the plotter object.
+// Description:		Writes the final estimates from the online identifier to
+//					the log (for comparison with the full regression).
 //
 // Input Arguments:
 //		None
@@ -1321,46 +1695,24 @@ bool SousVide::CleanUpAutoTuneLog(std::vector<double> &time,
 //		None
 //
 //==========================================================================
-void SousVide::ResetPlot(void)
+void SousVide::LogIdentifierEstimate(void)
 {
-	if (plotter)
-	{
-		// Ensure we're done all outstanding operations
-		plotter->WaitForGNUPlot();
-		delete plotter;
-	}
-
-	plotter = new GNUPlotter(logger);
-	if (!plotter->PipeIsOpen())
+	RecursiveIdentifier::Estimate estimate;
+	if (!identifier.GetEstimate(estimate))
 		return;
 
-	yMin = controller->GetActualTemperature();
-	yMax = yMin;
-
-	plotStartTime = time(NULL);
-
-	std::string cleanPath(configuration->system.temperaturePlotPath);
-	if (*(cleanPath.end() - 1) != '/')
-		cleanPath.append("/");
-
-	plotter->SendCommand("set terminal png size 800,600");
-	plotter->SendCommand("set output \"" + cleanPath + plotFileName + "\"");
-
-	plotter->SendCommand("set multiplot");
-	plotter->SendCommand("set title \"Temperature History\"");
-	plotter->SendCommand("set xlabel \"Time [min]\"");
-	plotter->SendCommand("set ylabel \"Temperature [deg F]\"");
-
-	plotter->SendCommand("set grid");
-	plotter->SendCommand("set style line 1 lt 1 lc rgb \"red\" lw 2");
-	plotter->SendCommand("set style line 2 lt 1 lc rgb \"blue\" lw 2");
+	logger << "Online model estimates (" << estimate.sampleCount << " samples):" << std::endl;
+	logger << "  c1 = " << estimate.c1 << " +/- " << estimate.c1StandardDeviation << " 1/sec" << std::endl;
+	logger << "  c2 = " << estimate.c2 << " +/- " << estimate.c2StandardDeviation << " deg F/BTU" << std::endl;
+	logger << "  tau = " << estimate.tau << " sec" << std::endl;
+	logger << "  Ambient Temp. = " << estimate.ambientTemperature << " deg F" << std::endl;
 }
 
 //==========================================================================
 // Class:			SousVide
-// Function:		UpdatePlotFile
+// Function:		ResetPlot
 //
-// Description:		Resets the plotter object.
+// Description:		Asks the plot thread to start a new plot.
 //
 // Input Arguments:
 //		None
@@ -1372,52 +1724,17 @@ void SousVide::ResetPlot(void)
 //		None
 //
 //==========================================================================
-void SousVide::UpdatePlotFile(void)
+void SousVide::ResetPlot(void)
 {
-	assert(plotter);
-
-	double cmdMin = *std::min_element(plotCommandedTemperature.begin(), plotCommandedTemperature.end());
-	double cmdMax = *std::min_element(plotActualTemperature.begin(), plotActualTemperature.end());
-	double actMin = *std::max_element(plotCommandedTemperature.begin(), plotCommandedTemperature.end());
-	double actMax = *std::max_element(plotActualTemperature.begin(), plotActualTemperature.end());
-
-	if (cmdMin < yMin)
-		yMin = cmdMin;
-	if (actMin < yMin)
-		yMin = actMin;
-	if (cmdMax > yMax)
-		yMax = cmdMax;
-	if (actMax > yMax)
-		yMax = actMax;
-
-	const double yPadding(1.05);
-	std::stringstream s;
-	s << "[" << yMin * yPadding << ":" << yMax * yPadding << "]" << std::endl;
-	plotter->SendCommand("set yrange " + s.str());
-
-	const double legendXRatio(0.1), legendYRatio(0.9), legendEntryHeightRatio(0.05);
-	const double xRange(plotTime[plotTime.size() - 1]);
-	const double xLegend(xRange * legendXRatio);// xMin is always zero
-	const double yRange((yMax - yMin) * yPadding);
-	const double yLegend(yRange * legendYRatio + yMin);
-	const double entryHeight(yRange * legendEntryHeightRatio);
-
-	s.str("");
-	s << xLegend << "," << yLegend;
-	plotter->SendCommand("set key at " + s.str());
-	plotter->PlotYAgainstX(0, plotTime, plotCommandedTemperature, "title \"Commanded\" ls 1 with lines");
-
-	s.str("");
-	s << xLegend << "," << yLegend - entryHeight;
-	plotter->SendCommand("set key at " + s.str());
-	plotter->PlotYAgainstX(1, plotTime, plotActualTemperature, "title \"Actual\" ls 2 with lines");
-
-	plotter->SendCommand("replot");
-	plotter->WaitForGNUPlot();
-
-	plotTime.clear();
-	plotCommandedTemperature.clear();
-	plotActualTemperature.clear();
+	plotStartTime = MonotonicClock::GetTime();
+	plotSamplesSinceRedraw = 0;
+
+	std::string cleanPath(configuration->system.temperaturePlotPath);
+	if (*(cleanPath.end() - 1) != '/')
+		cleanPath.append("/");
+
+	if (!plotWorker->Reset(cleanPath + plotFileName, controller->GetActualTemperature()))
+		logger << "Warning:  Failed to reset temperature plot (plot queue is full)" << std::endl;
 }
 
 //==========================================================================
@@ -1440,8 +1757,9 @@ void SousVide::UpdatePlotFile(void)
 void SousVide::UpdatePlotData(double commandedTemperature,
 	double actualTemperature)
 {
-	time_t now = time(NULL);
-	plotTime.push_back(difftime(now, plotStartTime) / 60.0);// Plot time in minutes
-	plotCommandedTemperature.push_back(commandedTemperature);
-	plotActualTemperature.push_back(actualTemperature);
+	// Samples that don't fit in the queue are counted (and reported) by the
+	// plot worker
+	if (plotWorker->AddSample(MonotonicClock::GetElapsedTime(plotStartTime) / 60.0,// Plot time in minutes
+		commandedTemperature, actualTemperature))
+		plotSamplesSinceRedraw++;
 }
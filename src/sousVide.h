@@ -9,22 +9,28 @@
 
 // Standard C++ headers
 #include <string>
-#include <ctime>
 #include <fstream>
 #include <vector>
-#include <time.h>
 
 // Local headers
 #include "logging/combinedLogger.h"
+#include "timingHistogram.h"
+#include "loopStatistics.h"
+#include "timeHistoryBuffer.h"
+#include "recursiveIdentifier.h"
 
 // Local forward declarations
 class NetworkInterface;
 class TemperatureController;
 class GPIO;
 class TimeHistoryLog;
+class BinaryLogWriter;
+class AsyncLogBuffer;
+class MappedLogReader;
 struct FrontToBackMessage;
 struct BackToFrontMessage;
-class GNUPlotter;
+struct TelemetryMessage;
+class PlotWorker;
 class TimingUtility;
 class SousVideConfig;
 
@@ -56,10 +62,14 @@ public:
 		CmdStop,
 		CmdReset,
 		CmdAutoTune,
+		CmdGetLoopStatistics,
+		CmdResetLoopStatistics,
+		CmdGetHistory,
 		CmdNone
 	};
 
 	static void PrintUsageInfo(std::string name);
+	static std::string GetStateName(const State &state);
 
 private:
 	static const std::string configFileName;
@@ -77,10 +87,31 @@ private:
 	std::ofstream logFile;
 
 	TimingUtility *loopTimer;
+	void SetLoopFrequency(double frequency);
+	double loopPeriod;// [sec]
+	bool loopPeriodChanged;
+
+	// Deviation of actual loop period from desired loop period, reset on
+	// entering and logged on leaving each active state
+	TimingHistogram jitterHistogram;
+	void LogLoopStatistics(void);
+
+	// Period, work time and overruns for each state
+	LoopStatistics loopStatistics;
+
+	// Recent controller samples, readable from any thread
+	static const unsigned int historySize;// [samples]
+	TimeHistoryBuffer history;
+	void RecordHistory(const double &time);
+
+	static const unsigned int stackPrefaultSize;// [bytes]
+	bool EnableRealTimeMode(void);
+	static void PrefaultStack(void);
 
 	NetworkInterface *ni;
 	void ProcessMessage(const FrontToBackMessage &recievedMessage);
 	BackToFrontMessage AssembleMessage(void) const;
+	TelemetryMessage AssembleTelemetry(void) const;
 	void AppendToErrorMessage(std::string message);
 	std::string errorMessage;
 	bool sendClientMessage;
@@ -88,19 +119,34 @@ private:
 	TemperatureController *controller;
 	GPIO *pumpRelay;
 
+	// File I/O for the time history log happens on a separate thread
+	// Cooking logs are binary (cookLog); auto-tune logs are text (thLog)
 	TimeHistoryLog *thLog;
-	std::ofstream *thLogFile;
-	std::string GetLogFileName(const std::string &activity = "cooking") const;
+	BinaryLogWriter *cookLog;
+	double logStartTime;// [sec]
+	AsyncLogBuffer *thLogBuffer;
+	std::ostream *thLogStream;
+	std::string GetLogFileName(const std::string &activity = "cooking",
+		const std::string &extension = ".log") const;
+	void OpenTimeHistoryLog(const std::string &fileName);
 	void SetUpTimeHistoryLog(void);
-	void CleanUpTimeHistoryLog(void);
+	void LogCookingData(const double &commandedTemperature,
+		const double &actualTemperature);
+	void CleanUpTimeHistoryLog(const bool &waitForWriter = false);
 
 	void SetUpAutoTuneLog(void);
-	bool CleanUpAutoTuneLog(std::vector<double> &time, std::vector<double> &temperature);
+	bool CleanUpAutoTuneLog(MappedLogReader &log);
 	double startTemperature;// [deg F]
 
+	// Model estimates are updated every loop during auto-tuning
+	RecursiveIdentifier identifier;
+	static const unsigned int autoTuneReportInterval;// [samples]
+	unsigned int autoTuneSamplesSinceReport;
+	void LogIdentifierEstimate(void);
+
 	// Finite state machine
 	State state, nextState;
-	time_t stateStartTime;
+	double stateStartTime;// [sec]
 
 	void UpdateState(void);
 	void EnterState(void);
@@ -114,7 +160,7 @@ private:
 	bool TemperatureTrackingToleranceExceeded(void);
 	bool MaximumTemperatureExceeded(void);
 	bool TemperatureSensorFailed(void);
-	time_t saturationStartTime;
+	double saturationStartTime;// [sec]
 	bool lastOutputSaturated;
 
 	void EnterActiveState(void);
@@ -122,14 +168,13 @@ private:
 
 	Command command;
 
-	GNUPlotter *plotter;
+	PlotWorker *plotWorker;
 	void ResetPlot(void);
-	void UpdatePlotFile(void);
 	void UpdatePlotData(double commandedTemperature, double actualTemperature);
-	std::vector<double> plotTime, plotCommandedTemperature, plotActualTemperature;
-	double yMin, yMax;
+	unsigned int plotSamplesSinceRedraw;
+	static const unsigned int plotRedrawInterval;// [samples]
 	static const std::string plotFileName;
-	time_t plotStartTime;
+	double plotStartTime;// [sec]
 };
 
 #endif// SOUS_VIDE_H_
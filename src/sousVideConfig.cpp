@@ -6,6 +6,8 @@
 
 // *nix headers
 #include <sys/stat.h>
+#include <sched.h>
+#include <unistd.h>
 
 // Local headers
 #include "sousVideConfig.h"
@@ -31,6 +33,7 @@
 void SousVideConfig::BuildConfigItems(void)
 {
 	AddConfigItem("port", network.port);
+	AddConfigItem("telemetryPort", network.telemetryPort);
 
 	AddConfigItem("pumpPin", io.pumpRelayPin);
 	AddConfigItem("heaterPin", io.heaterRelayPin);
@@ -55,7 +58,11 @@ void SousVideConfig::BuildConfigItems(void)
 	AddConfigItem("maxHeatingRate", system.maxHeatingRate);
 	AddConfigItem("maxAutoTuneTime", system.maxAutoTuneTime);
 	AddConfigItem("maxAutoTuneTemperatureRise", system.maxAutoTuneTemperatureRise);
+	AddConfigItem("autoTuneConvergenceTolerance", system.autoTuneConvergenceTolerance);
 	AddConfigItem("temperaturePlotPath", system.temperaturePlotPath);
+	AddConfigItem("logFlushInterval", system.logFlushInterval);
+	AddConfigItem("realTimePriority", system.realTimePriority);
+	AddConfigItem("cpuAffinity", system.cpuAffinity);
 }
 
 //==========================================================================
@@ -79,6 +86,7 @@ void SousVideConfig::BuildConfigItems(void)
 void SousVideConfig::AssignDefaults(void)
 {
 	network.port = 2770;
+	network.telemetryPort = 2771;
 
 	io.pumpRelayPin = 0;
 	io.heaterRelayPin = 1;
@@ -103,7 +111,11 @@ void SousVideConfig::AssignDefaults(void)
 	system.maxHeatingRate = -1.0;// [deg F/sec] invalid -> must be specified by user
 	system.maxAutoTuneTime = 30.0 * 60.0;// [sec]
 	system.maxAutoTuneTemperatureRise = 15.0;// [deg F]
+	system.autoTuneConvergenceTolerance = 0.0;// [-] (0 == OFF)
 	system.temperaturePlotPath = ".";
+	system.logFlushInterval = 10.0;// [sec]
+	system.realTimePriority = 0;
+	system.cpuAffinity = -1;
 }
 
 //==========================================================================
@@ -166,6 +178,22 @@ bool SousVideConfig::NetworkConfigIsOK(void)
 		ok = false;
 	}
 
+	if (network.telemetryPort != 0)
+	{
+		if (network.telemetryPort < 1024)
+		{
+			AppendToErrorMessage("Network:  "
+				+ GetKey(network.telemetryPort) + " must be 1024 or greater (or 0 to disable)");
+			ok = false;
+		}
+		else if (network.telemetryPort == network.port)
+		{
+			AppendToErrorMessage("Network:  "
+				+ GetKey(network.telemetryPort) + " must be different from " + GetKey(network.port));
+			ok = false;
+		}
+	}
+
 	return ok;
 }
 
@@ -429,6 +457,12 @@ bool SousVideConfig::SystemConfigIsOK(void)
 		ok = false;
 	}
 
+	if (system.autoTuneConvergenceTolerance < 0.0)
+	{
+		AppendToErrorMessage("System:  " + GetKey(system.autoTuneConvergenceTolerance) + " must be positive");
+		ok = false;
+	}
+
 	struct stat info;
 	if (stat(system.temperaturePlotPath.c_str(), &info) != 0)
 	{
@@ -443,6 +477,30 @@ bool SousVideConfig::SystemConfigIsOK(void)
 	}
 #endif
 
+	if (system.logFlushInterval <= 0.0)
+	{
+		AppendToErrorMessage("System:  " + GetKey(system.logFlushInterval) + " must be strictly positive");
+		ok = false;
+	}
+
+	const int maxPriority(sched_get_priority_max(SCHED_FIFO));
+	if (system.realTimePriority < 0 || system.realTimePriority > maxPriority)
+	{
+		std::stringstream ss;
+		ss << maxPriority;
+		AppendToErrorMessage("System:  " + GetKey(system.realTimePriority) + " must be between 0 and " + ss.str());
+		ok = false;
+	}
+
+	const long cpuCount(sysconf(_SC_NPROCESSORS_CONF));
+	if (system.cpuAffinity < -1 || system.cpuAffinity >= cpuCount)
+	{
+		std::stringstream ss;
+		ss << cpuCount - 1;
+		AppendToErrorMessage("System:  " + GetKey(system.cpuAffinity) + " must be -1 or between 0 and " + ss.str());
+		ok = false;
+	}
+
 	return ok;
 }
 
@@ -13,6 +13,7 @@
 struct NetworkConfiguration
 {
 	unsigned short port;
+	unsigned short telemetryPort;// 0 == OFF
 };
 
 struct IOConfiguration
@@ -59,8 +60,15 @@ struct SystemConfiguration
 
 	double maxAutoTuneTime;// [sec]
 	double maxAutoTuneTemperatureRise;// [deg F]
+	double autoTuneConvergenceTolerance;// [-] (0 == always run for maxAutoTuneTime)
 
 	std::string temperaturePlotPath;
+
+	double logFlushInterval;// [sec]
+
+	// Real-time options for the control loop thread
+	int realTimePriority;// SCHED_FIFO priority (0 == OFF)
+	int cpuAffinity;// CPU to which the control loop is pinned (-1 == any)
 };
 
 struct SousVideConfig : public ConfigFile
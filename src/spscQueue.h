@@ -0,0 +1,155 @@
+// File:  spscQueue.h
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Copy:  (c) Copyright 2026
+// Desc:  Bounded, lock-free, single-producer/single-consumer queue.  Exactly one
+//        thread may call Push() and exactly one (other) thread may call Pop().
+//        Neither call ever blocks; items that do not fit are counted and
+//        discarded by Push().
+
+#ifndef SPSC_QUEUE_H_
+#define SPSC_QUEUE_H_
+
+template <class T>
+class SPSCQueue
+{
+public:
+	explicit SPSCQueue(const unsigned int &capacity);
+	~SPSCQueue();
+
+	bool Push(const T &item);// Producer thread only
+	bool Pop(T &item);// Consumer thread only
+
+	bool IsEmpty(void) const { return head == tail; };
+	unsigned int GetCapacity(void) const { return size - 1; };
+	unsigned int GetOverflowCount(void) const { return overflowCount; };
+
+private:
+	// One slot is always left empty to distinguish "full" from "empty"
+	const unsigned int size;
+	T *buffer;
+
+	volatile unsigned int head;// Next slot to read (written only by consumer)
+	volatile unsigned int tail;// Next slot to write (written only by producer)
+	volatile unsigned int overflowCount;// Written only by producer
+
+	// Not copyable
+	SPSCQueue(const SPSCQueue &);
+	SPSCQueue& operator=(const SPSCQueue &);
+};
+
+//==========================================================================
+// Class:			SPSCQueue
+// Function:		SPSCQueue
+//
+// Description:		Constructor for SPSCQueue class.  All memory is allocated
+//					here.
+//
+// Input Arguments:
+//		capacity	= const unsigned int&, maximum number of queued items
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+template <class T>
+SPSCQueue<T>::SPSCQueue(const unsigned int &capacity) : size(capacity + 1)
+{
+	buffer = new T[size];
+	head = 0;
+	tail = 0;
+	overflowCount = 0;
+}
+
+//==========================================================================
+// Class:			SPSCQueue
+// Function:		~SPSCQueue
+//
+// Description:		Destructor for SPSCQueue class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+template <class T>
+SPSCQueue<T>::~SPSCQueue()
+{
+	delete [] buffer;
+}
+
+//==========================================================================
+// Class:			SPSCQueue
+// Function:		Push
+//
+// Description:		Adds an item to the back of the queue.  If the queue is
+//					full, the item is discarded and the overflow count is
+//					incremented.  Must only be called from the producer thread.
+//
+// Input Arguments:
+//		item	= const T&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if the item was queued, false if the queue was full
+//
+//==========================================================================
+template <class T>
+bool SPSCQueue<T>::Push(const T &item)
+{
+	const unsigned int next((tail + 1) % size);
+	if (next == head)
+	{
+		overflowCount++;
+		return false;
+	}
+
+	buffer[tail] = item;
+	__sync_synchronize();// Item must be visible before the new tail
+	tail = next;
+
+	return true;
+}
+
+//==========================================================================
+// Class:			SPSCQueue
+// Function:		Pop
+//
+// Description:		Removes the item at the front of the queue, if there is
+//					one.  Must only be called from the consumer thread.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		item	= T&
+//
+// Return Value:
+//		bool, true if an item was removed, false if the queue was empty
+//
+//==========================================================================
+template <class T>
+bool SPSCQueue<T>::Pop(T &item)
+{
+	if (head == tail)
+		return false;
+
+	__sync_synchronize();// Don't read the item before we've seen the tail
+	item = buffer[head];
+	__sync_synchronize();// Finish reading before releasing the slot
+	head = (head + 1) % size;
+
+	return true;
+}
+
+#endif// SPSC_QUEUE_H_
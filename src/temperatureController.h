@@ -40,6 +40,11 @@ public:
 	double GetPWMDuty(void) const;
 	bool OutputIsSaturated(void) const;
 
+	using PIDController::GetProportionalOutput;
+	using PIDController::GetIntegralOutput;
+	using PIDController::GetDerivativeOutput;
+	using PIDController::GetFeedForwardOutput;
+
 private:
 	TemperatureSensor* const sensor;
 	PWMOutput* const pwmOut;
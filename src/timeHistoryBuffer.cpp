@@ -0,0 +1,325 @@
+// File:  timeHistoryBuffer.cpp
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Copy:  (c) Copyright 2026
+// Desc:  Fixed-capacity ring buffer of controller samples.  Exactly one thread
+//        (the control loop) may call Add() and Clear(); any number of other
+//        threads may read at the same time without locks.  Each slot carries
+//        a sequence number (a per-slot seqlock), so readers can detect and
+//        discard samples that were overwritten while they were being copied.
+//        All memory is allocated by the constructor.
+
+// Standard C++ headers
+#include <cassert>
+
+// Local headers
+#include "timeHistoryBuffer.h"
+
+//==========================================================================
+// Class:			TimeHistoryBuffer
+// Function:		TimeHistoryBuffer
+//
+// Description:		Constructor for TimeHistoryBuffer class.  All memory is
+//					allocated here.
+//
+// Input Arguments:
+//		capacity	= const unsigned int&, maximum number of stored samples
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+TimeHistoryBuffer::TimeHistoryBuffer(const unsigned int &capacity)
+	: capacity(capacity)
+{
+	assert(capacity > 0);
+
+	slots = new Slot[capacity];
+	unsigned int i;
+	for (i = 0; i < capacity; i++)
+		slots[i].sequence = 0;
+
+	writeCount = 0;
+	firstIndex = 0;
+}
+
+//==========================================================================
+// Class:			TimeHistoryBuffer
+// Function:		~TimeHistoryBuffer
+//
+// Description:		Destructor for TimeHistoryBuffer class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+TimeHistoryBuffer::~TimeHistoryBuffer()
+{
+	delete [] slots;
+}
+
+//==========================================================================
+// Class:			TimeHistoryBuffer
+// Function:		Add
+//
+// Description:		Stores a sample, overwriting the oldest sample if the
+//					buffer is full.  Must only be called from the writer
+//					thread.  Sample times must be non-decreasing.
+//
+// Input Arguments:
+//		sample	= const Sample&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void TimeHistoryBuffer::Add(const Sample &sample)
+{
+	const unsigned long index(writeCount);
+	Slot &slot(slots[index % capacity]);
+
+	slot.sequence = 2 * index + 1;
+	__sync_synchronize();// Readers must see the slot is busy before it changes
+	slot.sample = sample;
+	__sync_synchronize();// Sample must be complete before it is published
+	slot.sequence = 2 * index + 2;
+	__sync_synchronize();
+	writeCount = index + 1;
+}
+
+//==========================================================================
+// Class:			TimeHistoryBuffer
+// Function:		Clear
+//
+// Description:		Hides all samples added so far from readers.  Must only be
+//					called from the writer thread.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void TimeHistoryBuffer::Clear(void)
+{
+	firstIndex = writeCount;
+}
+
+//==========================================================================
+// Class:			TimeHistoryBuffer
+// Function:		GetLatest
+//
+// Description:		Copies up to maxCount of the most recent samples.
+//
+// Input Arguments:
+//		maxCount	= const unsigned int&, size of the samples array
+//
+// Output Arguments:
+//		samples		= Sample*, oldest first
+//
+// Return Value:
+//		unsigned int, number of samples copied
+//
+//==========================================================================
+unsigned int TimeHistoryBuffer::GetLatest(Sample *samples,
+	const unsigned int &maxCount) const
+{
+	const unsigned long end(writeCount);
+	__sync_synchronize();
+
+	unsigned long index(GetOldestIndex(end));
+	if (end - index > maxCount)
+		index = end - maxCount;
+
+	unsigned int count(0);
+	for (; index < end; index++)
+	{
+		// Failures can only be the oldest samples, overwritten while we read
+		if (Read(index, samples[count]))
+			count++;
+	}
+
+	return count;
+}
+
+//==========================================================================
+// Class:			TimeHistoryBuffer
+// Function:		GetWindow
+//
+// Description:		Copies samples with times between startTime and endTime
+//					(inclusive).  If there are more than maxCount, the oldest
+//					maxCount samples are returned.
+//
+// Input Arguments:
+//		startTime	= const double& [sec]
+//		endTime		= const double& [sec]
+//		maxCount	= const unsigned int&, size of the samples array
+//
+// Output Arguments:
+//		samples		= Sample*, oldest first
+//
+// Return Value:
+//		unsigned int, number of samples copied
+//
+//==========================================================================
+unsigned int TimeHistoryBuffer::GetWindow(const double &startTime,
+	const double &endTime, Sample *samples, const unsigned int &maxCount) const
+{
+	const unsigned long end(writeCount);
+	__sync_synchronize();
+
+	unsigned long index(FindFirstAtOrAfter(startTime, GetOldestIndex(end), end));
+	unsigned int count(0);
+	for (; index < end && count < maxCount; index++)
+	{
+		if (!Read(index, samples[count]))
+			continue;
+
+		if (samples[count].time > endTime)
+			break;
+		count++;
+	}
+
+	return count;
+}
+
+//==========================================================================
+// Class:			TimeHistoryBuffer
+// Function:		GetMostRecent
+//
+// Description:		Copies the most recent sample.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		sample	= Sample&
+//
+// Return Value:
+//		bool, true if a sample was available, false otherwise
+//
+//==========================================================================
+bool TimeHistoryBuffer::GetMostRecent(Sample &sample) const
+{
+	const unsigned long end(writeCount);
+	__sync_synchronize();
+
+	if (end == GetOldestIndex(end))
+		return false;
+
+	return Read(end - 1, sample);
+}
+
+//==========================================================================
+// Class:			TimeHistoryBuffer
+// Function:		Read
+//
+// Description:		Copies the sample with the specified index, if it is
+//					still in the buffer and was not modified during the copy.
+//
+// Input Arguments:
+//		index	= const unsigned long&
+//
+// Output Arguments:
+//		sample	= Sample&
+//
+// Return Value:
+//		bool, true if the copy is valid, false otherwise
+//
+//==========================================================================
+bool TimeHistoryBuffer::Read(const unsigned long &index, Sample &sample) const
+{
+	const Slot &slot(slots[index % capacity]);
+	const unsigned long expected(2 * index + 2);
+
+	if (slot.sequence != expected)
+		return false;
+
+	__sync_synchronize();// Don't read the sample before the sequence
+	sample = slot.sample;
+	__sync_synchronize();// Finish reading the sample before checking again
+
+	return slot.sequence == expected;
+}
+
+//==========================================================================
+// Class:			TimeHistoryBuffer
+// Function:		GetOldestIndex
+//
+// Description:		Returns the index of the oldest sample that is still
+//					available (and not cleared), given the write count.
+//
+// Input Arguments:
+//		end	= const unsigned long&, write count
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		unsigned long
+//
+//==========================================================================
+unsigned long TimeHistoryBuffer::GetOldestIndex(const unsigned long &end) const
+{
+	unsigned long begin(0);
+	if (end > capacity)
+		begin = end - capacity;
+
+	const unsigned long cleared(firstIndex);
+	if (cleared > begin)
+		return cleared;
+	return begin;
+}
+
+//==========================================================================
+// Class:			TimeHistoryBuffer
+// Function:		FindFirstAtOrAfter
+//
+// Description:		Binary search for the first sample with a time no earlier
+//					than the specified time.  Samples that were overwritten
+//					during the search are treated as too old.
+//
+// Input Arguments:
+//		time	= const double& [sec]
+//		begin	= unsigned long, first index to search
+//		end		= unsigned long, one past the last index to search
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		unsigned long, end if no sample is late enough
+//
+//==========================================================================
+unsigned long TimeHistoryBuffer::FindFirstAtOrAfter(const double &time,
+	unsigned long begin, unsigned long end) const
+{
+	Sample sample;
+	unsigned long middle;
+	while (begin < end)
+	{
+		middle = begin + (end - begin) / 2;
+		if (!Read(middle, sample) || sample.time < time)
+			begin = middle + 1;
+		else
+			end = middle;
+	}
+
+	return begin;
+}
@@ -0,0 +1,76 @@
+// File:  timeHistoryBuffer.h
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Copy:  (c) Copyright 2026
+// Desc:  Fixed-capacity ring buffer of controller samples.  Exactly one thread
+//        (the control loop) may call Add() and Clear(); any number of other
+//        threads may read at the same time without locks.  Each slot carries
+//        a sequence number (a per-slot seqlock), so readers can detect and
+//        discard samples that were overwritten while they were being copied.
+//        All memory is allocated by the constructor.
+
+#ifndef TIME_HISTORY_BUFFER_H_
+#define TIME_HISTORY_BUFFER_H_
+
+class TimeHistoryBuffer
+{
+public:
+	explicit TimeHistoryBuffer(const unsigned int &capacity);
+	~TimeHistoryBuffer();
+
+	struct Sample
+	{
+		double time;// [sec] (MonotonicClock time)
+		double commandedTemperature;// [deg F]
+		double actualTemperature;// [deg F]
+		double pwmDuty;// [-]
+
+		// Contributions to PWM duty
+		double proportionalTerm;// [-]
+		double integralTerm;// [-]
+		double derivativeTerm;// [-]
+		double feedForwardTerm;// [-]
+
+		int state;// SousVide::State
+	};
+
+	// Writer thread only
+	void Add(const Sample &sample);
+	void Clear(void);
+
+	// Any thread; samples are returned oldest first
+	unsigned int GetLatest(Sample *samples, const unsigned int &maxCount) const;
+	unsigned int GetWindow(const double &startTime, const double &endTime,
+		Sample *samples, const unsigned int &maxCount) const;
+	bool GetMostRecent(Sample &sample) const;
+
+	unsigned int GetCapacity(void) const { return capacity; };
+	unsigned long GetTotalCount(void) const { return writeCount; };
+
+private:
+	const unsigned int capacity;
+
+	struct Slot
+	{
+		// 2 * index + 1 while sample index is being written, 2 * index + 2
+		// once it is complete (0 == never written)
+		volatile unsigned long sequence;
+		Sample sample;
+	};
+
+	Slot *slots;
+
+	volatile unsigned long writeCount;// Total number of samples added
+	volatile unsigned long firstIndex;// Oldest index not removed by Clear()
+
+	bool Read(const unsigned long &index, Sample &sample) const;
+	unsigned long GetOldestIndex(const unsigned long &end) const;
+	unsigned long FindFirstAtOrAfter(const double &time,
+		unsigned long begin, unsigned long end) const;
+
+	// Not copyable
+	TimeHistoryBuffer(const TimeHistoryBuffer &);
+	TimeHistoryBuffer& operator=(const TimeHistoryBuffer &);
+};
+
+#endif// TIME_HISTORY_BUFFER_H_
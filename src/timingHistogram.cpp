@@ -0,0 +1,180 @@
+// File:  timingHistogram.cpp
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Copy:  (c) Copyright 2026
+// Desc:  Fixed-size histogram of time intervals.  Bucket widths double from
+//        one bucket to the next (1 usec, 2 usec, 4 usec, ...), so a wide range
+//        is covered with few buckets.  Adding a sample never allocates memory.
+
+// Standard C++ headers
+#include <cassert>
+
+// Local headers
+#include "timingHistogram.h"
+
+//==========================================================================
+// Class:			TimingHistogram
+// Function:		TimingHistogram
+//
+// Description:		Constructor for TimingHistogram class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+TimingHistogram::TimingHistogram()
+{
+	Reset();
+}
+
+//==========================================================================
+// Class:			TimingHistogram
+// Function:		Reset
+//
+// Description:		Discards all samples.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void TimingHistogram::Reset(void)
+{
+	unsigned int i;
+	for (i = 0; i < bucketCount; i++)
+		counts[i] = 0;
+
+	totalCount = 0;
+	sum = 0.0;
+	maximum = 0.0;
+}
+
+//==========================================================================
+// Class:			TimingHistogram
+// Function:		Add
+//
+// Description:		Adds a sample to the histogram.  Bucket zero holds
+//					samples shorter than 1 usec, bucket i holds samples in
+//					the range [2^(i-1), 2^i) usec and the last bucket also
+//					holds everything longer.
+//
+// Input Arguments:
+//		interval	= const double& [sec]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void TimingHistogram::Add(const double &interval)
+{
+	const double microseconds(interval * 1.0e6);
+	double limit(1.0);
+	unsigned int bucket(0);
+	while (microseconds >= limit && bucket < bucketCount - 1)
+	{
+		limit *= 2.0;
+		bucket++;
+	}
+
+	counts[bucket]++;
+	totalCount++;
+	sum += interval;
+	if (interval > maximum)
+		maximum = interval;
+}
+
+//==========================================================================
+// Class:			TimingHistogram
+// Function:		GetBucketUpperLimit
+//
+// Description:		Returns the (exclusive) upper limit of the specified
+//					bucket.  The last bucket has no upper limit, but the value
+//					it would have is returned.
+//
+// Input Arguments:
+//		bucket	= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		double [sec]
+//
+//==========================================================================
+double TimingHistogram::GetBucketUpperLimit(const unsigned int &bucket)
+{
+	assert(bucket < bucketCount);
+	return (1UL << bucket) * 1.0e-6;
+}
+
+//==========================================================================
+// Class:			TimingHistogram
+// Function:		GetMean
+//
+// Description:		Returns the average of all samples.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		double [sec]
+//
+//==========================================================================
+double TimingHistogram::GetMean(void) const
+{
+	if (totalCount == 0)
+		return 0.0;
+	return sum / totalCount;
+}
+
+//==========================================================================
+// Class:			TimingHistogram
+// Function:		Print
+//
+// Description:		Writes a summary and the non-empty buckets to the stream.
+//
+// Input Arguments:
+//		stream	= std::ostream&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void TimingHistogram::Print(std::ostream &stream) const
+{
+	stream << "  Samples: " << totalCount << ", mean: " << GetMean() * 1.0e6
+		<< " usec, max: " << maximum * 1.0e6 << " usec" << std::endl;
+
+	unsigned int i;
+	for (i = 0; i < bucketCount; i++)
+	{
+		if (counts[i] == 0)
+			continue;
+
+		if (i == bucketCount - 1)
+			stream << "    >= " << GetBucketUpperLimit(i - 1) * 1.0e6;
+		else
+			stream << "    < " << GetBucketUpperLimit(i) * 1.0e6;
+		stream << " usec: " << counts[i] << std::endl;
+	}
+}
@@ -0,0 +1,41 @@
+// File:  timingHistogram.h
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Copy:  (c) Copyright 2026
+// Desc:  Fixed-size histogram of time intervals.  Bucket widths double from
+//        one bucket to the next (1 usec, 2 usec, 4 usec, ...), so a wide range
+//        is covered with few buckets.  Adding a sample never allocates memory.
+
+#ifndef TIMING_HISTOGRAM_H_
+#define TIMING_HISTOGRAM_H_
+
+// Standard C++ headers
+#include <ostream>
+
+class TimingHistogram
+{
+public:
+	TimingHistogram();
+
+	void Reset(void);
+	void Add(const double &interval);// [sec]
+
+	static const unsigned int bucketCount = 24;
+
+	unsigned long GetCount(const unsigned int &bucket) const { return counts[bucket]; };
+	static double GetBucketUpperLimit(const unsigned int &bucket);// [sec]
+
+	unsigned long GetTotalCount(void) const { return totalCount; };
+	double GetMean(void) const;// [sec]
+	double GetMaximum(void) const { return maximum; };// [sec]
+
+	void Print(std::ostream &stream) const;
+
+private:
+	unsigned long counts[bucketCount];
+	unsigned long totalCount;
+	double sum;// [sec]
+	double maximum;// [sec]
+};
+
+#endif// TIMING_HISTOGRAM_H_
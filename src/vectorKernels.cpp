@@ -0,0 +1,245 @@
+// File:  vectorKernels.cpp
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Copy:  (c) Copyright 2026
+// Desc:  Inner loops for Matrix products (dot products and scaled additions
+//        of double arrays).  The instruction set is chosen when compiling:
+//        AVX if the compiler targets it (e.g. -mavx2 or -march=native),
+//        otherwise SSE2 (always available on x86-64), or NEON on 64-bit
+//        ARM.  Other targets (including the 32-bit Raspberry
+//        Pi, where NEON has no double-precision operations) use the portable
+//        scalar versions, which are always available for comparison.  Define
+//        VECTOR_KERNELS_SCALAR to use the scalar versions on any target.
+//        Vectorized dot products are accumulated in a different order than
+//        the scalar versions, so results may differ by rounding.
+
+// Local headers
+#include "vectorKernels.h"
+
+// Each supported instruction set provides a packet type holding
+// packetSize doubles, and the few operations the kernels need.  The kernels
+// below are written once in terms of these.  These are macros rather than
+// inline functions so that unoptimized (-O0) builds are not slowed by extra
+// function calls.
+#if defined(VECTOR_KERNELS_SCALAR)
+// Use portable versions
+#elif defined(__AVX__)
+#include <immintrin.h>
+#define VECTOR_KERNELS_SIMD "AVX"
+typedef __m256d Packet;
+static const unsigned int packetSize(4);
+#define PacketLoad(p) _mm256_loadu_pd(p)
+#define PacketStore(p, a) _mm256_storeu_pd(p, a)
+#define PacketSet(value) _mm256_set1_pd(value)
+#define PacketAdd(a, b) _mm256_add_pd(a, b)
+#define PacketMultiply(a, b) _mm256_mul_pd(a, b)
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define VECTOR_KERNELS_SIMD "SSE2"
+typedef __m128d Packet;
+static const unsigned int packetSize(2);
+#define PacketLoad(p) _mm_loadu_pd(p)
+#define PacketStore(p, a) _mm_storeu_pd(p, a)
+#define PacketSet(value) _mm_set1_pd(value)
+#define PacketAdd(a, b) _mm_add_pd(a, b)
+#define PacketMultiply(a, b) _mm_mul_pd(a, b)
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define VECTOR_KERNELS_SIMD "NEON"
+typedef float64x2_t Packet;
+static const unsigned int packetSize(2);
+#define PacketLoad(p) vld1q_f64(p)
+#define PacketStore(p, a) vst1q_f64(p, a)
+#define PacketSet(value) vdupq_n_f64(value)
+#define PacketAdd(a, b) vaddq_f64(a, b)
+#define PacketMultiply(a, b) vmulq_f64(a, b)
+#endif
+
+#ifdef VECTOR_KERNELS_SIMD
+//==========================================================================
+// Class:			None
+// Function:		PacketHorizontalSum
+//
+// Description:		Returns the sum of the elements of the packet.
+//
+// Input Arguments:
+//		a	= const Packet&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		double
+//
+//==========================================================================
+static inline double PacketHorizontalSum(const Packet &a)
+{
+	double values[packetSize];
+	PacketStore(values, a);
+
+	double sum(values[0]);
+	unsigned int i;
+	for (i = 1; i < packetSize; i++)
+		sum += values[i];
+
+	return sum;
+}
+#endif// VECTOR_KERNELS_SIMD
+
+//==========================================================================
+// Class:			VectorKernels
+// Function:		Dot
+//
+// Description:		Returns the dot product of two arrays.  Two packets are
+//					accumulated at once, so consecutive additions do not
+//					wait on each other.
+//
+// Input Arguments:
+//		a		= const double*
+//		b		= const double*
+//		count	= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		double
+//
+//==========================================================================
+double VectorKernels::Dot(const double *a, const double *b, const unsigned int &count)
+{
+#ifdef VECTOR_KERNELS_SIMD
+	Packet sum0(PacketSet(0.0)), sum1(PacketSet(0.0));
+	unsigned int i(0);
+	for (; i + 2 * packetSize <= count; i += 2 * packetSize)
+	{
+		sum0 = PacketAdd(sum0, PacketMultiply(PacketLoad(a + i), PacketLoad(b + i)));
+		sum1 = PacketAdd(sum1, PacketMultiply(PacketLoad(a + i + packetSize),
+			PacketLoad(b + i + packetSize)));
+	}
+
+	double sum(PacketHorizontalSum(PacketAdd(sum0, sum1)));
+	for (; i < count; i++)
+		sum += a[i] * b[i];
+
+	return sum;
+#else
+	return DotScalar(a, b, count);
+#endif
+}
+
+//==========================================================================
+// Class:			VectorKernels
+// Function:		AddScaled
+//
+// Description:		Adds a multiple of one array to another (y += scale * x).
+//
+// Input Arguments:
+//		x		= const double*
+//		scale	= const double&
+//		count	= const unsigned int&
+//
+// Output Arguments:
+//		y		= double*
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void VectorKernels::AddScaled(double *y, const double *x, const double &scale,
+	const unsigned int &count)
+{
+#ifdef VECTOR_KERNELS_SIMD
+	const Packet scalePacket(PacketSet(scale));
+	unsigned int i(0);
+	for (; i + packetSize <= count; i += packetSize)
+		PacketStore(y + i, PacketAdd(PacketLoad(y + i),
+			PacketMultiply(scalePacket, PacketLoad(x + i))));
+
+	for (; i < count; i++)
+		y[i] += scale * x[i];
+#else
+	AddScaledScalar(y, x, scale, count);
+#endif
+}
+
+//==========================================================================
+// Class:			VectorKernels
+// Function:		DotScalar
+//
+// Description:		Returns the dot product of two arrays (portable version).
+//
+// Input Arguments:
+//		a		= const double*
+//		b		= const double*
+//		count	= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		double
+//
+//==========================================================================
+double VectorKernels::DotScalar(const double *a, const double *b, const unsigned int &count)
+{
+	double sum(0.0);
+	unsigned int i;
+	for (i = 0; i < count; i++)
+		sum += a[i] * b[i];
+
+	return sum;
+}
+
+//==========================================================================
+// Class:			VectorKernels
+// Function:		AddScaledScalar
+//
+// Description:		Adds a multiple of one array to another (y += scale * x,
+//					portable version).
+//
+// Input Arguments:
+//		x		= const double*
+//		scale	= const double&
+//		count	= const unsigned int&
+//
+// Output Arguments:
+//		y		= double*
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+void VectorKernels::AddScaledScalar(double *y, const double *x, const double &scale,
+	const unsigned int &count)
+{
+	unsigned int i;
+	for (i = 0; i < count; i++)
+		y[i] += scale * x[i];
+}
+
+//==========================================================================
+// Class:			VectorKernels
+// Function:		GetInstructionSet
+//
+// Description:		Returns the name of the instruction set the kernels were
+//					compiled for.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		const char*
+//
+//==========================================================================
+const char *VectorKernels::GetInstructionSet(void)
+{
+#ifdef VECTOR_KERNELS_SIMD
+	return VECTOR_KERNELS_SIMD;
+#else
+	return "scalar";
+#endif
+}
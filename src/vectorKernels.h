@@ -0,0 +1,35 @@
+// File:  vectorKernels.h
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Copy:  (c) Copyright 2026
+// Desc:  Inner loops for Matrix products (dot products and scaled additions
+//        of double arrays).  The instruction set is chosen when compiling:
+//        AVX if the compiler targets it (e.g. -mavx2 or -march=native),
+//        otherwise SSE2 (always available on x86-64), or NEON on 64-bit
+//        ARM.  Other targets (including the 32-bit Raspberry
+//        Pi, where NEON has no double-precision operations) use the portable
+//        scalar versions, which are always available for comparison.  Define
+//        VECTOR_KERNELS_SCALAR to use the scalar versions on any target.
+//        Vectorized dot products are accumulated in a different order than
+//        the scalar versions, so results may differ by rounding.
+
+#ifndef VECTOR_KERNELS_H_
+#define VECTOR_KERNELS_H_
+
+struct VectorKernels
+{
+	// Vectorized where supported
+	static double Dot(const double *a, const double *b, const unsigned int &count);
+	static void AddScaled(double *y, const double *x, const double &scale,
+		const unsigned int &count);// y += scale * x
+
+	// Portable versions
+	static double DotScalar(const double *a, const double *b, const unsigned int &count);
+	static void AddScaledScalar(double *y, const double *x, const double &scale,
+		const unsigned int &count);
+
+	// "AVX", "SSE2", "NEON" or "scalar"
+	static const char *GetInstructionSet(void);
+};
+
+#endif// VECTOR_KERNELS_H_
@@ -0,0 +1,71 @@
+// File:  workerThread.cpp
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Copy:  (c) Copyright 2026
+// Desc:  Creates the application's helper threads (socket listeners, log
+//        writer, plot worker) with a small fixed stack.  In real-time mode,
+//        mlockall() makes every thread stack fully resident, so with the
+//        default stack size (typically 8 MB) each helper thread would pin
+//        that much memory.  None of these threads keep large objects on the
+//        stack.
+
+// *nix headers
+#include <limits.h>
+
+// Local headers
+#include "workerThread.h"
+
+//==========================================================================
+// Class:			WorkerThread
+// Function:		Constant definitions
+//
+// Description:		Constant definitions for WorkerThread class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//==========================================================================
+const size_t WorkerThread::stackSize(128 * 1024);
+
+//==========================================================================
+// Class:			WorkerThread
+// Function:		Create
+//
+// Description:		Spawns a thread with a stack of stackSize bytes (or at
+//					least PTHREAD_STACK_MIN).
+//
+// Input Arguments:
+//		function	= void *(*)(void*), thread entry point
+//		argument	= void*, passed to function
+//
+// Output Arguments:
+//		thread		= pthread_t&
+//
+// Return Value:
+//		int, zero for success, otherwise an error number
+//
+//==========================================================================
+int WorkerThread::Create(pthread_t &thread, void *(*function)(void*),
+	void *argument)
+{
+	pthread_attr_t attributes;
+	int errorNumber;
+	if ((errorNumber = pthread_attr_init(&attributes)) != 0)
+		return errorNumber;
+
+	size_t size(stackSize);
+	if (size < static_cast<size_t>(PTHREAD_STACK_MIN))
+		size = static_cast<size_t>(PTHREAD_STACK_MIN);
+
+	if ((errorNumber = pthread_attr_setstacksize(&attributes, size)) == 0)
+		errorNumber = pthread_create(&thread, &attributes, function, argument);
+
+	pthread_attr_destroy(&attributes);
+	return errorNumber;
+}
@@ -0,0 +1,29 @@
+// File:  workerThread.h
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Copy:  (c) Copyright 2026
+// Desc:  Creates the application's helper threads (socket listeners, log
+//        writer, plot worker) with a small fixed stack.  In real-time mode,
+//        mlockall() makes every thread stack fully resident, so with the
+//        default stack size (typically 8 MB) each helper thread would pin
+//        that much memory.  None of these threads keep large objects on the
+//        stack.
+
+#ifndef WORKER_THREAD_H_
+#define WORKER_THREAD_H_
+
+// Standard C++ headers
+#include <cstddef>
+
+// *nix headers
+#include <pthread.h>
+
+struct WorkerThread
+{
+	static const size_t stackSize;// [bytes]
+
+	// Same arguments and return value as pthread_create()
+	static int Create(pthread_t &thread, void *(*function)(void*), void *argument);
+};
+
+#endif// WORKER_THREAD_H_
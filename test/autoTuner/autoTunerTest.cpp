@@ -2,7 +2,8 @@
 // Date:  9/19/2013
 // Auth:  K. Loux
 // Copy:  (c) Copyright 2013
-// Desc:  Test application for heated tank auto tuner.
+// Desc:  Test application for heated tank auto tuner.  Also compares the
+//        tau search against the hill-climb it replaced.
 
 // Standard C++ headers
 #include <cstdlib>
@@ -11,9 +12,16 @@
 #include <fstream>
 #include <string>
 #include <sstream>
+#include <cmath>
+
+// *nix headers
+#include <time.h>
 
 // Local headers
 #include "autoTuner.h"
+#include "matrix.h"
+#include "mappedLogReader.h"
+#include "recursiveIdentifier.h"
 
 using namespace std;
 
@@ -43,27 +51,22 @@ void CreateData()
 	of.close();
 }
 
-// Application entry point
-int main(int argc, char *argv[])
-{	
-	/*CreateData();
-	return 0;//*/
-
-	if (argc != 2)
-	{
-		cout << "Usage:  " << argv[0] << " pathToFile" << endl;
-		return 1;
-	}
+double GetTime(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + now.tv_nsec * 1.0e-9;
+}
 
-	ifstream dataFile(argv[1], ios::in);
+// The way logs used to be read, for comparison with MappedLogReader
+bool ReadWithStringStream(const char *fileName, vector<double> &time,
+	vector<double> &temp)
+{
+	ifstream dataFile(fileName, ios::in);
 	if (!dataFile.is_open() || !dataFile.good())
-	{
-		cout << "Failed to open '" << argv[1] << "' for input" << endl;
-		return 1;
-	}
+		return false;
 
 	string line;
-	vector<double> time, temp;
 	double value;
 	stringstream ss;
 	
@@ -85,8 +88,304 @@ int main(int argc, char *argv[])
 		temp.push_back(value);
 	}
 
-	dataFile.close();
+	return true;
+}
+
+// Checks that both methods read the same values (to within rounding), and
+// compares the time required
+bool CompareReaders(const char *fileName, const DataSpan &time,
+	const DataSpan &temp)
+{
+	const unsigned int iterations(20);
+	unsigned int i, j;
+	vector<double> streamTime, streamTemp;
+	double start(GetTime());
+	for (i = 0; i < iterations; i++)
+	{
+		streamTime.clear();
+		streamTemp.clear();
+		ReadWithStringStream(fileName, streamTime, streamTemp);
+	}
+	const double streamReadTime((GetTime() - start) / iterations);
+
+	MappedLogReader reader;
+	start = GetTime();
+	for (i = 0; i < iterations; i++)
+		reader.Read(fileName, 2);
+	const double mappedReadTime((GetTime() - start) / iterations);
+
+	if (streamTime.size() != time.size())
+	{
+		cout << "Readers found different numbers of rows ("
+			<< streamTime.size() << " vs. " << time.size() << ")" << endl;
+		return false;
+	}
+
+	const double tolerance(1.0e-15);// Relative
+	for (j = 0; j < time.size(); j++)
+	{
+		if (fabs(streamTime[j] - time[j]) > tolerance * fabs(streamTime[j]) ||
+			fabs(streamTemp[j] - temp[j]) > tolerance * fabs(streamTemp[j]))
+		{
+			cout << "Readers disagree on row " << j + 1 << endl;
+			return false;
+		}
+	}
+
+	cout << "Read " << time.size() << " rows in " << mappedReadTime * 1000.0
+		<< " msec (stringstream:  " << streamReadTime * 1000.0 << " msec)" << endl;
+
+	return true;
+}
+
+// Feeds the data to the online identifier one sample at a time, as the
+// application does while auto-tuning
+void RunOnlineIdentifier(const DataSpan &time, const DataSpan &temp)
+{
+	const double tolerance(0.05);
+	RecursiveIdentifier identifier;
+	double convergedTime(-1.0);
+	unsigned int i;
+	for (i = 0; i < time.size(); i++)
+	{
+		identifier.Add(time[i], temp[i]);
+		if (convergedTime < 0.0 && identifier.IsConverged(tolerance))
+			convergedTime = time[i];
+	}
+
+	RecursiveIdentifier::Estimate estimate;
+	if (!identifier.GetEstimate(estimate))
+	{
+		cout << "Not enough data for online estimate" << endl;
+		return;
+	}
+
+	cout << "Online model estimates:" << endl;
+	cout << "  c1 = " << estimate.c1 << " +/- " << estimate.c1StandardDeviation << " 1/sec" << endl;
+	cout << "  c2 = " << estimate.c2 << " +/- " << estimate.c2StandardDeviation << " deg F/BTU" << endl;
+	cout << "  tau = " << estimate.tau << " sec" << endl;
+	cout << "  Ambient Temp. = " << estimate.ambientTemperature << " deg F" << endl;
+	if (convergedTime < 0.0)
+		cout << "  Did not converge to within " << tolerance * 100.0 << "%" << endl;
+	else
+		cout << "  Converged to within " << tolerance * 100.0 << "% after "
+			<< convergedTime << " sec" << endl;
+	cout << endl;
+}
+
+// The tau search AutoTuner used before Brent's method:  a hill-climb on the
+// coefficient of determination, with a full regression at every step.  Kept
+// here for comparison.
+void AssignHeatStateValue(const DataSpan &time, Matrix &A, const double &tau)
+{
+	double heatState(0.0);
+	unsigned int i;
+	for (i = 0; i < A.GetNumberOfRows(); i++)
+	{
+		A(i,2) = heatState;
+		heatState += (time[i + 1] - time[i]) * (AutoTuner::GetControlSignal(time[i]) - heatState) / tau;
+	}
+}
+
+double ComputeCoefficientOfDetermination(const Matrix &measured,
+	const Matrix &modeled)
+{
+	double modeledAverage(0.0);
+	unsigned int i;
+	for (i = 0; i < modeled.GetNumberOfRows(); i++)
+		modeledAverage += modeled(i,0);
+	modeledAverage /= modeled.GetNumberOfRows();
+
+	double sumSqResiduals(0.0), sumSqTotal(0.0);
+	for (i = 0; i < modeled.GetNumberOfRows(); i++)
+	{
+		sumSqResiduals += (measured(i,0) - modeled(i,0)) * (measured(i,0) - modeled(i,0));
+		sumSqTotal += (measured(i,0) - modeledAverage) * (measured(i,0) - modeledAverage);
+	}
+
+	return 1.0 - sumSqResiduals / sumSqTotal;
+}
+
+bool HillClimbSearchForTau(const DataSpan &time, const DataSpan &temperature,
+	double &tau)
+{
+	Matrix A(time.size() - 1, 3), b(time.size() - 1, 1);
+	unsigned int i;
+	for (i = 0; i < b.GetNumberOfRows(); i++)
+	{
+		A(i,0) = 1.0;
+		A(i,1) = -temperature[i];
+		b(i,0) = (temperature[i + 1] - temperature[i]) / (time[i + 1] - time[i]);
+	}
+
+	const double tolerance(0.01);// [sec]
+	const double scaleFactor(1.01);
+	double minTauGuess(0.1), maxTauGuess(1000.0), tauGuess, rSq1, rSq2;
+	const unsigned int iterationLimit(1000);
+	unsigned int iteration;
+	Matrix x;
+
+	for (iteration = 0; iteration < iterationLimit; iteration++)
+	{
+		tauGuess = minTauGuess + 0.5 * (maxTauGuess - minTauGuess);
+		AssignHeatStateValue(time, A, tauGuess);
+		if (!A.LeftDivide(b, x))
+			return false;
+		rSq1 = ComputeCoefficientOfDetermination(b, A * x);
+
+		tauGuess *= scaleFactor;
+		AssignHeatStateValue(time, A, tauGuess);
+		if (!A.LeftDivide(b, x))
+			return false;
+		rSq2 = ComputeCoefficientOfDetermination(b, A * x);
+
+		if (rSq2 > rSq1)// Positive slope
+			minTauGuess = tauGuess / scaleFactor;
+		else
+			maxTauGuess = tauGuess / scaleFactor;
+
+		if (maxTauGuess - minTauGuess < tolerance)
+			break;
+	}
+
+	tau = minTauGuess + 0.5 * (maxTauGuess - minTauGuess);
+
+	return true;
+}
+
+// Times AutoTuner (Brent's method for tau, then the final regression) against
+// the hill-climb search alone on the same data
+void CompareTauSearches(const DataSpan &time, const DataSpan &temp)
+{
+	const unsigned int iterations(20);
+	unsigned int i;
+
+	// Any failure is reported once, by the caller
+	ostringstream quiet;
+	AutoTuner tuner(quiet);
+	double start(GetTime());
+	for (i = 0; i < iterations; i++)
+		tuner.ProcessAutoTuneData(time, temp);
+	const double brentTime((GetTime() - start) / iterations);
+
+	double hillClimbTau(0.0);
+	bool hillClimbSuccess(true);
+	start = GetTime();
+	for (i = 0; i < iterations; i++)
+		hillClimbSuccess = HillClimbSearchForTau(time, temp, hillClimbTau);
+	const double hillClimbTime((GetTime() - start) / iterations);
+
+	cout << "Tau search:" << endl;
+	cout << "  Brent:       tau = " << tuner.GetTau() << " sec, "
+		<< brentTime * 1000.0 << " msec (including final regression)" << endl;
+	cout << "  Hill-climb:  ";
+	if (hillClimbSuccess)
+		cout << "tau = " << hillClimbTau << " sec, ";
+	else
+		cout << "failed, ";
+	cout << hillClimbTime * 1000.0 << " msec" << endl;
+	cout << endl;
+}
+
+// Times the simulation over a long series (about 3 hours at 10 Hz), using the
+// same model as CreateData() so it runs whether or not auto-tuning succeeds
+void TimeSimulation(void)
+{
+	AutoTuner tuner;
+	tuner.DefineParameters(0.000625, 0.125, 10.0);
+
+	const unsigned int count(100000);
+	std::vector<double> time, control, temperature;
+	time.reserve(count);
+	control.reserve(count);
+	unsigned int i;
+	for (i = 0; i < count; i++)
+	{
+		time.push_back(i * 0.1);
+		control.push_back(AutoTuner::GetControlSignal(time[i]));
+	}
+
+	const double start(GetTime());
+	if (!tuner.GetSimulatedOpenLoopResponse(time, control, temperature, 60.0, 62.0))
+	{
+		cout << "Simulation failed" << endl;
+		return;
+	}
+	const double elapsed(GetTime() - start);
+	cout << "Simulated " << count << " steps in " << elapsed * 1000.0
+		<< " msec (" << elapsed * 1.0e9 / count << " nsec/step)" << endl;
+}
+
+// Temperature data that is a linear function of the heater state for tau0
+// (plus a perturbation far below the conditioning limit) must be rejected at
+// tau0, where the two regression columns are nearly collinear, but not at
+// other values of tau
+bool CheckCollinearTauRejected(void)
+{
+	const double tau0(20.0);// [sec]
+	const unsigned int count(1000);
+	std::vector<double> time, temperature;
+	double heatState(0.0);
+	unsigned int i;
+	for (i = 0; i < count; i++)
+	{
+		time.push_back(i * 0.1);
+		temperature.push_back(60.0 + 50.0 * heatState + 1.0e-9 * sin(i * 1.0));
+		heatState += 0.1 * (AutoTuner::GetControlSignal(time[i]) - heatState) / tau0;
+	}
 
+	AutoTuner tuner;
+	double sumSquares;
+	bool ok(true);
+	if (tuner.GetSumSquaredResiduals(time, temperature, tau0, sumSquares))
+	{
+		cout << "FAIL:  Near-collinear tau was accepted (sum of squares = "
+			<< sumSquares << ")" << endl;
+		ok = false;
+	}
+
+	if (!tuner.GetSumSquaredResiduals(time, temperature, 2.0, sumSquares))
+	{
+		cout << "FAIL:  Well-conditioned tau was rejected" << endl;
+		ok = false;
+	}
+
+	if (ok)
+		cout << "Near-collinear tau is rejected" << endl << endl;
+
+	return ok;
+}
+
+// Application entry point
+int main(int argc, char *argv[])
+{	
+	/*CreateData();
+	return 0;//*/
+
+	if (argc != 2)
+	{
+		cout << "Usage:  " << argv[0] << " pathToFile" << endl;
+		return 1;
+	}
+
+	MappedLogReader log;
+	if (!log.Read(argv[1], 2))
+		return 1;
+
+	const DataSpan time(log.GetColumn(0));
+	const DataSpan temp(log.GetColumn(1));
+	if (!CompareReaders(argv[1], time, temp))
+		return 1;
+
+	RunOnlineIdentifier(time, temp);
+	TimeSimulation();
+
+	if (!CheckCollinearTauRejected())
+		return 1;
+
+	CompareTauSearches(time, temp);
+
+	unsigned int i;
 	AutoTuner tuner;
 	if (!tuner.ProcessAutoTuneData(time, temp))
 	{
@@ -110,7 +409,6 @@ int main(int argc, char *argv[])
 
 	std::vector<double> simulatedTemp;
 	std::vector<double> controlInput;
-	unsigned int i;
 	for (i = 0; i < time.size(); i++)
 		controlInput.push_back(AutoTuner::GetControlSignal(time[i]));
 	cout << endl << "Simulating time response..." << endl;
@@ -0,0 +1,317 @@
+// File:  binaryLogTest.cpp
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Copy:  (c) Copyright 2026
+// Desc:  Application for testing BinaryLogWriter and BinaryLogReader.  Checks
+//        that a log reads back correctly (including after truncation and
+//        corruption) and that completed blocks reach the file without a
+//        flush, then compares file size and write/read times against
+//        the text (CSV) logs and the stringstream parsing they require.
+
+// Standard C++ headers
+#include <cstdlib>
+#include <cstdio>
+#include <cmath>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// *nix headers
+#include <time.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Local headers
+#include "binaryLogWriter.h"
+#include "binaryLogReader.h"
+#include "binaryLogFormat.h"
+
+using namespace std;
+
+const char *binaryFileName("binaryLogTest.svlog");
+const char *textFileName("binaryLogTest.log");
+const unsigned int columnCount(3);// Not including time
+
+double GetTime(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + now.tv_nsec * 1.0e-9;
+}
+
+long GetFileSize(const char *fileName)
+{
+	struct stat info;
+	if (stat(fileName, &info) != 0)
+		return -1;
+	return info.st_size;
+}
+
+// Similar to a cooking log:  commanded and actual temperature and PWM duty
+void GetRecord(const unsigned int &i, double &time, double *values)
+{
+	time = i * 0.2;
+	values[0] = 135.0;
+	values[1] = 135.0 - 60.0 * exp(-time / 900.0) + 0.1 * sin(time);
+	values[2] = 0.5 + 0.5 * cos(time / 30.0);
+}
+
+bool WriteBinary(const unsigned int &count, const unsigned int &recordsPerBlock)
+{
+	ofstream file(binaryFileName, ios::out | ios::binary);
+	BinaryLogWriter writer(file, recordsPerBlock);
+	writer.AddColumn("Commanded Temperature", "deg F");
+	writer.AddColumn("Actual Temperature", "deg F");
+	writer.AddColumn("PWM Duty", "%");
+
+	double time, values[columnCount];
+	unsigned int i;
+	for (i = 0; i < count; i++)
+	{
+		GetRecord(i, time, values);
+		if (!writer.AddRecord(time, values))
+			return false;
+	}
+
+	return writer.Flush();
+}
+
+bool WriteText(const unsigned int &count)
+{
+	ofstream file(textFileName, ios::out);
+	file << "Time,Commanded Temperature,Actual Temperature,PWM Duty" << endl;
+	file << "sec,deg F,deg F,%" << endl;
+
+	double time, values[columnCount];
+	unsigned int i;
+	for (i = 0; i < count; i++)
+	{
+		GetRecord(i, time, values);
+		file << time << ',' << values[0] << ',' << values[1] << ','
+			<< values[2] << endl;
+	}
+
+	return file.good();
+}
+
+// Same approach as SousVide::CleanUpAutoTuneLog()
+bool ReadText(vector<vector<double> > &columns)
+{
+	ifstream file(textFileName, ios::in);
+	string line;
+	getline(file, line);
+	getline(file, line);
+
+	columns.resize(columnCount + 1);
+	double value;
+	stringstream ss;
+	unsigned int i;
+	while (getline(file, line))
+	{
+		ss.clear();
+		ss.str(line);
+		for (i = 0; i <= columnCount; i++)
+		{
+			if (!(ss >> value))
+				return false;
+			columns[i].push_back(value);
+			if (i < columnCount)
+				ss.ignore();
+		}
+	}
+
+	return true;
+}
+
+bool CheckContents(const BinaryLogReader &reader, const unsigned int &count)
+{
+	if (reader.GetColumnCount() != columnCount + 1 ||
+		reader.GetRecordCount() != count ||
+		reader.GetColumnName(0) != "Time" ||
+		reader.GetColumnName(2) != "Actual Temperature" ||
+		reader.GetColumnUnits(3) != "%")
+		return false;
+
+	double time, values[columnCount];
+	unsigned int i, j;
+	for (i = 0; i < count; i++)
+	{
+		GetRecord(i, time, values);
+		if (reader.GetColumn(0)[i] != time)
+			return false;
+
+		for (j = 0; j < columnCount; j++)
+		{
+			if (reader.GetColumn(j + 1)[i] != static_cast<float>(values[j]))
+				return false;
+		}
+	}
+
+	return true;
+}
+
+// Completed blocks must reach the file without calling Flush()
+bool CheckBlocksWritten(const unsigned int &blockCount,
+	const unsigned int &recordsPerBlock)
+{
+	ofstream file(binaryFileName, ios::out | ios::binary);
+	BinaryLogWriter writer(file, recordsPerBlock);
+	writer.AddColumn("Commanded Temperature", "deg F");
+	writer.AddColumn("Actual Temperature", "deg F");
+	writer.AddColumn("PWM Duty", "%");
+
+	const long blockSize(2 * sizeof(unsigned int) + recordsPerBlock
+		* BinaryLogFormat::GetRecordSize(columnCount + 1));
+	long firstBlockEnd(0);
+
+	double time, values[columnCount];
+	unsigned int i;
+	for (i = 0; i < blockCount * recordsPerBlock; i++)
+	{
+		GetRecord(i, time, values);
+		if (!writer.AddRecord(time, values))
+			return false;
+
+		// Nothing may be written until a block is complete
+		const long size(GetFileSize(binaryFileName));
+		if (i < recordsPerBlock - 1 && size != 0)
+			return false;
+		else if ((i + 1) % recordsPerBlock != 0)
+			continue;
+
+		if (i + 1 == recordsPerBlock)
+		{
+			firstBlockEnd = size;
+			if (size <= blockSize)
+				return false;
+		}
+		else if (size != firstBlockEnd + static_cast<long>(
+			(i + 1) / recordsPerBlock - 1) * blockSize)
+			return false;
+	}
+
+	// Read while the writer still has the file open
+	BinaryLogReader reader;
+	return reader.Read(binaryFileName) && !reader.IsDamaged() &&
+		CheckContents(reader, blockCount * recordsPerBlock);
+}
+
+bool ReportResult(const string &name, const bool &pass)
+{
+	cout << (pass ? "  PASS:  " : "  FAIL:  ") << name << endl;
+	return pass;
+}
+
+bool RunChecks(void)
+{
+	bool ok(true);
+	BinaryLogReader reader;
+
+	ok = ReportResult("Blocks written without Flush()",
+		CheckBlocksWritten(10, 10)) && ok;
+
+	ok = ReportResult("Empty log",
+		WriteBinary(0, 16) && reader.Read(binaryFileName) &&
+		!reader.IsDamaged() && CheckContents(reader, 0)) && ok;
+
+	// 100 records in blocks of 16 leaves a short block at the end
+	ok = ReportResult("Round trip",
+		WriteBinary(100, 16) && reader.Read(binaryFileName) &&
+		!reader.IsDamaged() && CheckContents(reader, 100)) && ok;
+
+	// Remove part of the last block
+	const long fullSize(GetFileSize(binaryFileName));
+	ok = ReportResult("Truncated log",
+		truncate(binaryFileName, fullSize - 10) == 0 &&
+		reader.Read(binaryFileName) && reader.IsDamaged() &&
+		CheckContents(reader, 96)) && ok;
+
+	// Flip a bit in the third block
+	WriteBinary(100, 16);
+	const long headerSize(fullSize - 6 * (16 * 20 + 8) - (4 * 20 + 8));
+	FILE *file(fopen(binaryFileName, "r+b"));
+	fseek(file, headerSize + 2 * (16 * 20 + 8) + 100, SEEK_SET);
+	const int c(fgetc(file));
+	fseek(file, -1, SEEK_CUR);
+	fputc(c ^ 0x04, file);
+	fclose(file);
+	ok = ReportResult("Corrupt block",
+		reader.Read(binaryFileName) && reader.IsDamaged() &&
+		CheckContents(reader, 32)) && ok;
+
+	// Damage the header
+	file = fopen(binaryFileName, "r+b");
+	fseek(file, 30, SEEK_SET);
+	fputc('x', file);
+	fclose(file);
+	ok = ReportResult("Corrupt header", !reader.Read(binaryFileName)) && ok;
+
+	return ok;
+}
+
+// Application entry point
+int main(int, char *[])
+{
+	cout << "Checking binary logs:" << endl;
+	if (!RunChecks())
+		return 1;
+
+	// About 14 hours at 5 Hz
+	const unsigned int count(250000);
+	cout << endl << "Comparing text and binary logs with " << count
+		<< " records:" << endl;
+
+	double start(GetTime());
+	if (!WriteText(count))
+	{
+		cout << "Failed to write text log" << endl;
+		return 1;
+	}
+	const double textWriteTime(GetTime() - start);
+
+	vector<vector<double> > textColumns;
+	start = GetTime();
+	if (!ReadText(textColumns))
+	{
+		cout << "Failed to read text log" << endl;
+		return 1;
+	}
+	const double textReadTime(GetTime() - start);
+
+	start = GetTime();
+	if (!WriteBinary(count, 128))
+	{
+		cout << "Failed to write binary log" << endl;
+		return 1;
+	}
+	const double binaryWriteTime(GetTime() - start);
+
+	BinaryLogReader reader;
+	start = GetTime();
+	if (!reader.Read(binaryFileName))
+	{
+		cout << "Failed to read binary log" << endl;
+		return 1;
+	}
+	const double binaryReadTime(GetTime() - start);
+
+	if (!CheckContents(reader, count))
+	{
+		cout << "Binary log contents are incorrect" << endl;
+		return 1;
+	}
+
+	cout << "  Text:    " << GetFileSize(textFileName) << " bytes, write "
+		<< textWriteTime * 1000.0 << " msec, read "
+		<< textReadTime * 1000.0 << " msec" << endl;
+	cout << "  Binary:  " << GetFileSize(binaryFileName) << " bytes, write "
+		<< binaryWriteTime * 1000.0 << " msec, read "
+		<< binaryReadTime * 1000.0 << " msec" << endl;
+
+	remove(textFileName);
+	remove(binaryFileName);
+
+	return 0;
+}
@@ -0,0 +1,73 @@
+// File:  chartRendererTest.cpp
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Copy:  (c) Copyright 2026
+// Desc:  Application for testing ChartRenderer class.  Draws the same two sine
+//        waves as the gnuPlot test, then reports how long it takes to render a
+//        chart the size of a full temperature history plot.
+
+// Standard C++ headers
+#include <cstdlib>
+#include <iostream>
+#include <cmath>
+#include <vector>
+
+// *nix headers
+#include <time.h>
+
+// Local headers
+#include "chartRenderer.h"
+
+using namespace std;
+
+double GetTime(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + now.tv_nsec * 1.0e-9;
+}
+
+// Application entry point
+int main(int, char *[])
+{
+	const unsigned int nPts(2000);
+	std::vector<double> data1, data2, time;
+	const double timeStep(0.01);
+
+	unsigned int i;
+	for (i = 0; i < nPts; i++)
+	{
+		time.push_back(i * timeStep);
+		data1.push_back(3.0 * sin(time[i] * 10.0) - 1.0);
+		data2.push_back(8.0 * sin(time[i] * 3.0));
+	}
+
+	ChartRenderer chart;
+	chart.SetTitle("Two Sine Waves");
+	chart.SetXLabel("Time [sec]");
+	chart.SetYLabel("Values [-]");
+	chart.SetXRange(0.0, time.back());
+	chart.SetYRange(-10.0, 10.0);
+	chart.AddSeries(time, data1, "Sine 1", "red");
+	chart.AddSeries(time, data2, "Sine 2", "blue");
+
+	if (!chart.Render("chartTest.svg"))
+	{
+		cout << "Failed to render chart" << endl;
+		return 1;
+	}
+
+	const unsigned int iterations(100);
+	const double start(GetTime());
+	for (i = 0; i < iterations; i++)
+	{
+		if (!chart.Render("chartTest.svg"))
+			return 1;
+	}
+
+	cout << "Rendered " << nPts << " points per series in "
+		<< (GetTime() - start) / iterations * 1.0e3 << " msec (average of "
+		<< iterations << " renders)" << endl;
+
+	return 0;
+}
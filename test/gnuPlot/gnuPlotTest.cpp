@@ -17,6 +17,7 @@ using namespace std;
 
 void PlotTwoSineWaves(void);
 void MakeThreePlotsByAppendingData(void);
+void MakeThreePlotsFromBinaryData(void);
 
 // Application entry point
 int main(int, char *[])
@@ -25,6 +26,7 @@ int main(int, char *[])
 
 	PlotTwoSineWaves();
 	MakeThreePlotsByAppendingData();
+	MakeThreePlotsFromBinaryData();
 
 	return 0;
 }
@@ -146,3 +148,39 @@ void MakeThreePlotsByAppendingData(void)
 	plotter.SendCommand("replot");
 	plotter.WaitForGNUPlot();
 }
+
+void MakeThreePlotsFromBinaryData(void)
+{
+	GNUPlotter plotter;
+	if (!plotter.PipeIsOpen())
+	{
+		cout << "gnuPlot pipe is broken" << endl;
+		exit(1);
+	}
+
+	plotter.SendCommand("set terminal png");
+	plotter.SendCommand("set grid");
+	plotter.SendCommand("unset key");
+
+	// Each plot should show the data from the previous plot plus 1000 new points
+	const unsigned int file(plotter.AddBinaryDataFile(2));
+	const std::string plotCommand("plot " + plotter.GetBinaryDataSource(file) + " using 1:2 with lines");
+	const unsigned int nPts(1000);
+	double record[2];
+
+	unsigned int i, j;
+	for (i = 0; i < 3; i++)
+	{
+		for (j = 0; j < nPts; j++)
+		{
+			record[0] = i * nPts + j;
+			record[1] = record[0] * 3.4 - 5.0;
+			plotter.AppendBinaryData(file, record);
+		}
+		plotter.FlushBinaryData(file);
+
+		plotter.SendCommand("set output \"binaryTest" + std::string(1, '1' + i) + ".png\"");
+		plotter.SendCommand(plotCommand);
+		plotter.WaitForGNUPlot();
+	}
+}
@@ -47,6 +47,7 @@ const std::string GNUPlotter::gnuPlotName = "pgnuplot.exe";
 #else
 const std::string GNUPlotter::gnuPlotName = "gnuplot";
 #endif
+const unsigned int GNUPlotter::binaryBufferSize = 16 * 1024;
 
 //==========================================================================
 // Class:			GNUPlotter
@@ -101,6 +102,14 @@ GNUPlotter::~GNUPlotter()
 		if (remove(tempFileNames[i].c_str()) != 0)
 			outStream << "Failed to remove temporary file '" << tempFileNames[i] << "'" << std::endl;
 	}
+
+	for (i = 0; i < binaryFiles.size(); i++)
+	{
+		if (binaryFiles[i].file && fclose(binaryFiles[i].file) != 0)
+			outStream << "Failed to close binary data file '" << binaryFiles[i].name << "'" << std::endl;
+		if (remove(binaryFiles[i].name.c_str()) != 0)
+			outStream << "Failed to remove binary data file '" << binaryFiles[i].name << "'" << std::endl;
+	}
 }
 
 //==========================================================================
@@ -330,7 +339,7 @@ bool GNUPlotter::WriteTemporaryFile(unsigned int i, const std::vector<double> &y
 
 	unsigned int j;
 	for (j = 0; j < y.size(); j++)
-		tempFile << y[j] << std::endl;
+		tempFile << y[j] << '\n';
 
 	tempFile.close();
 
@@ -374,13 +383,167 @@ bool GNUPlotter::WriteTemporaryFile(unsigned int i, const std::vector<double> &x
 
 	unsigned int j;
 	for (j = 0; j < y.size(); j++)
-		tempFile << x[j] << " " << y[j] << std::endl;
+		tempFile << x[j] << " " << y[j] << '\n';
 
 	tempFile.close();
 
 	return true;
 }
 
+//==========================================================================
+// Class:			GNUPlotter
+// Function:		AddBinaryDataFile
+//
+// Description:		Creates a new (empty) binary data file.  Each record in
+//					the file consists of the specified number of doubles.
+//
+// Input Arguments:
+//		columns	= unsigned int, number of values per record
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		unsigned int, index of the new file (to be used with the other binary
+//		data methods)
+//
+//==========================================================================
+unsigned int GNUPlotter::AddBinaryDataFile(unsigned int columns)
+{
+	assert(columns > 0);
+
+	BinaryDataFile data;
+	data.name = GetTemporaryFileName();
+	data.columns = columns;
+	data.recordCount = 0;
+	data.file = fopen(data.name.c_str(), "wb");
+	if (!data.file)
+		outStream << "Failed to open binary data file '" << data.name << "' for output" << std::endl;
+	else if (setvbuf(data.file, NULL, _IOFBF, binaryBufferSize) != 0)
+		outStream << "Failed to set buffer size for binary data file '" << data.name << "'" << std::endl;
+
+	binaryFiles.push_back(data);
+	return binaryFiles.size() - 1;
+}
+
+//==========================================================================
+// Class:			GNUPlotter
+// Function:		AppendBinaryData
+//
+// Description:		Appends one record to the specified binary data file.
+//					Writes are buffered; gnuplot will not see the new data
+//					until FlushBinaryData() is called.
+//
+// Input Arguments:
+//		i		= unsigned int specifying which file to use
+//		record	= const double*, must point to one value for each column
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if successful, false otherwise
+//
+//==========================================================================
+bool GNUPlotter::AppendBinaryData(unsigned int i, const double *record)
+{
+	assert(i < binaryFiles.size());
+
+	BinaryDataFile &data(binaryFiles[i]);
+	if (!data.file)
+		return false;
+
+	if (fwrite(record, sizeof(double), data.columns, data.file) != data.columns)
+	{
+		outStream << "Failed to write to binary data file '" << data.name << "'" << std::endl;
+		return false;
+	}
+
+	data.recordCount++;
+	return true;
+}
+
+//==========================================================================
+// Class:			GNUPlotter
+// Function:		FlushBinaryData
+//
+// Description:		Writes any buffered records to the specified binary data
+//					file.  Must be called before plotting the file.
+//
+// Input Arguments:
+//		i	= unsigned int specifying which file to use
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if successful, false otherwise
+//
+//==========================================================================
+bool GNUPlotter::FlushBinaryData(unsigned int i)
+{
+	assert(i < binaryFiles.size());
+
+	if (!binaryFiles[i].file || fflush(binaryFiles[i].file) != 0)
+	{
+		outStream << "Failed to flush binary data file '" << binaryFiles[i].name << "'" << std::endl;
+		return false;
+	}
+
+	return true;
+}
+
+//==========================================================================
+// Class:			GNUPlotter
+// Function:		GetBinaryDataSource
+//
+// Description:		Returns the file name and format specifier to use when
+//					plotting the specified binary data file (e.g. to be
+//					followed by "using 1:2").
+//
+// Input Arguments:
+//		i	= unsigned int specifying which file to use
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		std::string
+//
+//==========================================================================
+std::string GNUPlotter::GetBinaryDataSource(unsigned int i) const
+{
+	assert(i < binaryFiles.size());
+
+	std::stringstream s;
+	s << "\"" << binaryFiles[i].name << "\" binary format=\"%"
+		<< binaryFiles[i].columns << "double\"";
+	return s.str();
+}
+
+//==========================================================================
+// Class:			GNUPlotter
+// Function:		GetBinaryRecordCount
+//
+// Description:		Returns the number of records written to the specified
+//					binary data file.
+//
+// Input Arguments:
+//		i	= unsigned int specifying which file to use
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		unsigned long
+//
+//==========================================================================
+unsigned long GNUPlotter::GetBinaryRecordCount(unsigned int i) const
+{
+	assert(i < binaryFiles.size());
+	return binaryFiles[i].recordCount;
+}
+
 //==========================================================================
 // Class:			GNUPlotter
 // Function:		WaitForGNUPlot
@@ -33,6 +33,14 @@ public:
 	bool PlotYAgainstX(unsigned int i, const std::vector<double> &x,
 		const std::vector<double> &y, std::string args = "", bool append = true);
 
+	// Binary data files are written incrementally (one record of doubles at
+	// a time, buffered) and read by gnuplot using a binary format specifier
+	unsigned int AddBinaryDataFile(unsigned int columns);
+	bool AppendBinaryData(unsigned int i, const double *record);
+	bool FlushBinaryData(unsigned int i);
+	std::string GetBinaryDataSource(unsigned int i) const;
+	unsigned long GetBinaryRecordCount(unsigned int i) const;
+
 	bool WaitForGNUPlot(std::string fifoName = "gnuFIFO");
 
 private:
@@ -42,6 +50,17 @@ private:
 
 	FILE *gnuPipe;
 
+	struct BinaryDataFile
+	{
+		std::string name;
+		FILE *file;
+		unsigned int columns;
+		unsigned long recordCount;
+	};
+
+	std::vector<BinaryDataFile> binaryFiles;
+	static const unsigned int binaryBufferSize;// [bytes]
+
 	static std::string GetTemporaryFileName(void);
 	bool WriteTemporaryFile(unsigned int i, const std::vector<double> &y,
 		bool append) const;
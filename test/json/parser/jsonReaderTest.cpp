@@ -0,0 +1,253 @@
+// File:  jsonReaderTest.cpp
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Copy:  (c) Copyright 2026
+// Desc:  Test application for JSONReader.  Checks valid and malformed inputs
+//        (including reported error offsets), fuzzes the reader with mutated
+//        command messages (comparing results against cJSON), and compares
+//        parse throughput against cJSON.
+
+// Standard C++ headers
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// *nix headers
+#include <time.h>
+
+// Local headers
+#include "cJSON.h"
+#include "jsonReader.h"
+
+using namespace std;
+
+// Typical command messages from the front end
+const char *seedMessages[] = {
+	"{\"Command\":0,\"SetTemp\":135.5,\"SoakTime\":3600}",
+	"{ \"Command\" : 1 }",
+	"{\"Command\":3,\"Note\":\"caf\\u00e9 \\ud83d\\ude00\",\"List\":[1,{\"a\":null},true]}"
+};
+const unsigned int seedCount(sizeof(seedMessages) / sizeof(seedMessages[0]));
+
+double GetTime(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + now.tv_nsec * 1.0e-9;
+}
+
+// Copies the input into an exactly-sized heap buffer, so memory checkers
+// (e.g. valgrind) will catch any read past the terminator
+bool Parse(JSONReader &reader, const string &input, char *&buffer)
+{
+	buffer = static_cast<char*>(malloc(input.length() + 1));
+	memcpy(buffer, input.c_str(), input.length() + 1);
+	return reader.Parse(buffer);
+}
+
+bool CheckValid(const string &input, const char *key, double expected)
+{
+	JSONReader reader;
+	char *buffer;
+	bool ok(Parse(reader, input, buffer));
+	double value(0.0);
+	ok = ok && reader.Read(key, value) && value == expected;
+	free(buffer);
+
+	cout << (ok ? "  PASS:  " : "  FAIL:  ") << input << endl;
+	return ok;
+}
+
+bool CheckString(const string &input, const char *key, const string &expected)
+{
+	JSONReader reader;
+	char *buffer;
+	bool ok(Parse(reader, input, buffer));
+	const char *value(NULL);
+	ok = ok && reader.Read(key, value) && expected.compare(value) == 0;
+	free(buffer);
+
+	cout << (ok ? "  PASS:  " : "  FAIL:  ") << input << endl;
+	return ok;
+}
+
+bool CheckInvalid(const string &input, const unsigned int &expectedOffset)
+{
+	JSONReader reader;
+	char *buffer;
+	bool ok(!Parse(reader, input, buffer) && reader.GetErrorOffset() == expectedOffset);
+	free(buffer);
+
+	cout << (ok ? "  PASS:  " : "  FAIL:  ") << input << "  ->  "
+		<< reader.GetErrorMessage() << " at offset " << reader.GetErrorOffset() << endl;
+	return ok;
+}
+
+string Mutate(const string &seed)
+{
+	static const char interesting[] = "{}[]\",:\\-+.eE0123456789tfnu \t\n\x01\x7f\xc3";
+	string s(seed);
+	unsigned int i, mutations(1 + rand() % 4);
+	for (i = 0; i < mutations && !s.empty(); i++)
+	{
+		unsigned int position(rand() % s.length());
+		char c(rand() % 2 ? interesting[rand() % (sizeof(interesting) - 1)] : (char)(1 + rand() % 255));
+		switch (rand() % 4)
+		{
+		case 0:
+			s[position] = c;
+			break;
+
+		case 1:
+			s.insert(position, 1, c);
+			break;
+
+		case 2:
+			s.erase(position, 1);
+			break;
+
+		default:
+			s.erase(position);
+		}
+	}
+
+	return s;
+}
+
+// Returns false if both parsers accept the input but disagree about the value
+// of a numeric key.  cJSON is more lenient than JSONReader (e.g. it accepts
+// trailing characters), so inputs rejected by only one parser are expected.
+bool FuzzOne(const string &input, unsigned int &acceptedCount)
+{
+	JSONReader reader;
+	char *buffer;
+	bool accepted(Parse(reader, input, buffer));
+
+	bool ok(true);
+	if (accepted)
+	{
+		acceptedCount++;
+		cJSON *root = cJSON_Parse(input.c_str());
+		if (!root)
+		{
+			cout << "  Accepted input rejected by cJSON:  " << input << endl;
+			ok = false;
+		}
+		else
+		{
+			const char *keys[] = {"Command", "SetTemp", "SoakTime"};
+			unsigned int i;
+			double value;
+			cJSON *item;
+			for (i = 0; i < 3; i++)
+			{
+				item = cJSON_GetObjectItem(root, keys[i]);
+				if (reader.Read(keys[i], value) && item && item->type == cJSON_Number &&
+					fabs(item->valuedouble - value) > 1.0e-12 * fabs(value))
+				{
+					cout << "  Value mismatch for " << keys[i] << ":  " << input << endl;
+					ok = false;
+				}
+			}
+			cJSON_Delete(root);
+		}
+	}
+
+	free(buffer);
+	return ok;
+}
+
+// Application entry point
+int main(int, char *[])
+{
+	bool ok(true);
+
+	cout << "Valid input:" << endl;
+	ok = CheckValid(seedMessages[0], "SetTemp", 135.5) && ok;
+	ok = CheckValid(seedMessages[1], "Command", 1.0) && ok;
+	ok = CheckValid(" \r\n\t{\"a\":-0.5e+2}\n", "a", -50.0) && ok;
+	ok = CheckValid("{\"a\":{\"b\":[[],{}]},\"c\":0}", "c", 0.0) && ok;
+	ok = CheckValid("{\"k\\u0065y\":1E3}", "key", 1000.0) && ok;
+	ok = CheckString(seedMessages[2], "Note", "caf\xc3\xa9 \xf0\x9f\x98\x80") && ok;
+	ok = CheckString("{\"s\":\"\\\"\\\\\\/\\b\\f\\n\\r\\t\"}", "s", "\"\\/\b\f\n\r\t") && ok;
+
+	cout << endl << "Malformed input:" << endl;
+	ok = CheckInvalid("", 0) && ok;
+	ok = CheckInvalid("[1]", 0) && ok;
+	ok = CheckInvalid("{\"Command\":1,}", 13) && ok;
+	ok = CheckInvalid("{\"Command\" 1}", 11) && ok;
+	ok = CheckInvalid("{\"Command\":01}", 12) && ok;
+	ok = CheckInvalid("{\"Command\":1.}", 13) && ok;
+	ok = CheckInvalid("{\"Command\":-}", 12) && ok;
+	ok = CheckInvalid("{\"Command\":1e}", 13) && ok;
+	ok = CheckInvalid("{\"Command\":+1}", 11) && ok;
+	ok = CheckInvalid("{\"Command\":tru}", 11) && ok;
+	ok = CheckInvalid("{\"Command\":1} x", 14) && ok;
+	ok = CheckInvalid("{\"Command\":1", 12) && ok;
+	ok = CheckInvalid("{\"Command", 9) && ok;
+	ok = CheckInvalid("{\"a\":\"\\x\"}", 6) && ok;
+	ok = CheckInvalid("{\"a\":\"\\u12\"}", 6) && ok;
+	ok = CheckInvalid("{\"a\":\"\\ud83d\"}", 6) && ok;
+	ok = CheckInvalid("{\"a\":\"tab\there\"}", 9) && ok;
+	ok = CheckInvalid("{\"a\":[1,2}", 9) && ok;
+	ok = CheckInvalid("{\"a\":[[[[[[[[[[[[[[[[[[1]]]]]]]]]]]]]]]]]]}", 20) && ok;
+	ok = CheckInvalid("{\"a\":0,\"b\":1,\"c\":2,\"d\":3,\"e\":4,\"f\":5,\"g\":6,\"h\":7,"
+		"\"i\":8,\"j\":9,\"k\":10,\"l\":11,\"m\":12,\"n\":13,\"o\":14,\"p\":15,\"q\":16}", 103) && ok;
+
+	cout << endl << "Fuzzing:" << endl;
+	const unsigned int fuzzIterations(200000);
+	unsigned int i, acceptedCount(0), failureCount(0);
+	srand(2013);
+	for (i = 0; i < fuzzIterations; i++)
+	{
+		if (!FuzzOne(Mutate(seedMessages[rand() % seedCount]), acceptedCount))
+			failureCount++;
+	}
+	cout << "  " << fuzzIterations << " inputs, " << acceptedCount << " accepted, "
+		<< failureCount << " failures" << endl;
+	ok = ok && failureCount == 0;
+
+	cout << endl << "Parsing command message:" << endl;
+	const string message(seedMessages[0]);
+	const unsigned int iterations(100000);
+	vector<char> buffer(message.length() + 1);
+	double value, sum(0.0);
+
+	double start(GetTime());
+	for (i = 0; i < iterations; i++)
+	{
+		// Parsing is done in place, so each iteration needs a fresh copy
+		memcpy(&buffer.front(), message.c_str(), buffer.size());
+		cJSON *root = cJSON_Parse(&buffer.front());
+		sum += cJSON_GetObjectItem(root, "Command")->valueint;
+		sum += cJSON_GetObjectItem(root, "SetTemp")->valuedouble;
+		sum += cJSON_GetObjectItem(root, "SoakTime")->valuedouble;
+		cJSON_Delete(root);
+	}
+	double cJSONTime(GetTime() - start);
+
+	start = GetTime();
+	JSONReader reader;
+	for (i = 0; i < iterations; i++)
+	{
+		memcpy(&buffer.front(), message.c_str(), buffer.size());
+		reader.Parse(&buffer.front());
+		reader.Read("Command", value);
+		sum += value;
+		reader.Read("SetTemp", value);
+		sum += value;
+		reader.Read("SoakTime", value);
+		sum += value;
+	}
+	double readerTime(GetTime() - start);
+
+	cout << "  cJSON:       " << cJSONTime / iterations * 1.0e9 << " ns/message" << endl;
+	cout << "  JSONReader:  " << readerTime / iterations * 1.0e9 << " ns/message" << endl;
+	cout << "  Speedup:     " << cJSONTime / readerTime << "x" << endl;
+	cout << "  (checksum " << sum << ")" << endl;
+
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,160 @@
+// File:  jsonWriterTest.cpp
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Copy:  (c) Copyright 2026
+// Desc:  Test application for JSONWriter.  Checks output for a few tricky
+//        cases, then compares the time required to encode a status message
+//        with JSONWriter against the cJSON path previously used by
+//        NetworkInterface::EncodeMessage.
+
+// Standard C++ headers
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+// *nix headers
+#include <time.h>
+
+// Local headers
+#include "cJSON.h"
+#include "jsonWriter.h"
+
+using namespace std;
+
+// Same content as NetworkInterface sends each time the state is reported
+const string state("Soaking");
+const string errorMessage("");
+const double commandedTemperature(135.0);
+const double actualTemperature(134.8125);
+
+double GetTime(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + now.tv_nsec * 1.0e-9;
+}
+
+unsigned int EncodeWithCJSON(string &buffer)
+{
+	cJSON *root = cJSON_CreateObject();
+	cJSON_AddStringToObject(root, "State", state.c_str());
+	cJSON_AddStringToObject(root, "ErrMesg", errorMessage.c_str());
+	cJSON_AddNumberToObject(root, "CmdTemp", commandedTemperature);
+	cJSON_AddNumberToObject(root, "ActTemp", actualTemperature);
+
+	char *text = cJSON_PrintUnformatted(root);
+	cJSON_Delete(root);
+	buffer.assign(text);
+	free(text);
+
+	return buffer.length();
+}
+
+unsigned int EncodeWithWriter(JSONWriter &writer)
+{
+	writer.Reset();
+	writer.BeginObject();
+	writer.Write("State", state.c_str());
+	writer.Write("ErrMesg", errorMessage.c_str());
+	writer.Write("CmdTemp", commandedTemperature);
+	writer.Write("ActTemp", actualTemperature);
+	writer.EndObject();
+
+	return writer.GetLength();
+}
+
+bool CheckOutput(const string &name, const string &actual, const string &expected)
+{
+	if (actual.compare(expected) == 0)
+	{
+		cout << "  PASS:  " << name << endl;
+		return true;
+	}
+
+	cout << "  FAIL:  " << name << endl;
+	cout << "    expected:  " << expected << endl;
+	cout << "    actual:    " << actual << endl;
+	return false;
+}
+
+// Application entry point
+int main(int, char *[])
+{
+	const unsigned int bufferSize(1024);
+	char buffer[bufferSize];
+	JSONWriter writer(buffer, bufferSize);
+	bool ok(true);
+
+	cout << "Checking output:" << endl;
+
+	writer.BeginObject();
+	writer.Write("s", "quote\" slash\\ newline\n tab\t bell\a");
+	writer.Write("i", -42);
+	writer.Write("d", 0.1);
+	writer.Write("b", true);
+	writer.WriteNull("n");
+	writer.BeginArray("a");
+	writer.Write(NULL, 1.5e-20);
+	writer.BeginObject();
+	writer.EndObject();
+	writer.Write(NULL, false);
+	writer.EndArray();
+	writer.EndObject();
+	ok = CheckOutput("escaping, types and nesting", writer.GetString(),
+		"{\"s\":\"quote\\\" slash\\\\ newline\\n tab\\t bell\\u0007\",\"i\":-42,"
+		"\"d\":0.1,\"b\":true,\"n\":null,\"a\":[1.5e-20,{},false]}") && ok;
+
+	double zero(0.0);
+	writer.Reset();
+	writer.BeginArray();
+	writer.Write(NULL, zero / zero);
+	writer.Write(NULL, 1.0 / zero);
+	writer.EndArray();
+	ok = CheckOutput("non-finite numbers", writer.GetString(), "[null,null]") && ok;
+
+	char smallBuffer[8];
+	JSONWriter smallWriter(smallBuffer, sizeof(smallBuffer));
+	smallWriter.BeginObject();
+	smallWriter.Write("key", 123456.0);
+	smallWriter.EndObject();
+	ok = CheckOutput("overflow is reported", smallWriter.IsOK() ? "ok" : "overflow", "overflow") && ok;
+	ok = CheckOutput("overflow output is terminated",
+		string(smallBuffer, strlen(smallBuffer)), "{\"key\":") && ok;
+
+	// cJSON formats numbers differently, so compare the decoded values
+	EncodeWithWriter(writer);
+	cJSON *root = cJSON_Parse(writer.GetString());
+	ok = CheckOutput("status message is readable by cJSON", root ? "ok" : "parse error", "ok") && ok;
+	if (root)
+	{
+		ok = CheckOutput("State", cJSON_GetObjectItem(root, "State")->valuestring, state) && ok;
+		ok = CheckOutput("CmdTemp", cJSON_GetObjectItem(root, "CmdTemp")->valuedouble
+			== commandedTemperature ? "equal" : "different", "equal") && ok;
+		ok = CheckOutput("ActTemp", cJSON_GetObjectItem(root, "ActTemp")->valuedouble
+			== actualTemperature ? "equal" : "different", "equal") && ok;
+		cJSON_Delete(root);
+	}
+
+	cout << endl << "Encoding status message:" << endl;
+
+	string cJSONBuffer;
+	const unsigned int iterations(100000);
+	unsigned int i, totalLength(0);
+	double start(GetTime());
+	for (i = 0; i < iterations; i++)
+		totalLength += EncodeWithCJSON(cJSONBuffer);
+	double cJSONTime(GetTime() - start);
+
+	start = GetTime();
+	for (i = 0; i < iterations; i++)
+		totalLength += EncodeWithWriter(writer);
+	double writerTime(GetTime() - start);
+
+	cout << "  cJSON:       " << cJSONTime / iterations * 1.0e9 << " ns/message" << endl;
+	cout << "  JSONWriter:  " << writerTime / iterations * 1.0e9 << " ns/message" << endl;
+	cout << "  Speedup:     " << cJSONTime / writerTime << "x" << endl;
+	cout << "  (" << totalLength << " bytes encoded)" << endl;
+
+	return ok ? 0 : 1;
+}
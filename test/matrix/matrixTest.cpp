@@ -0,0 +1,492 @@
+// File:  matrixTest.cpp
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Copy:  (c) Copyright 2026
+// Desc:  Application for testing the Matrix class.  Checks basic operations,
+//        least-squares solutions and the vector kernels against known results
+//        (or the scalar kernels), then reports the time and number of heap
+//        allocations required for a regression the size of those performed by
+//        the AutoTuner, and the speed of the vector kernels.
+
+// Standard C++ headers
+#include <cstdlib>
+#include <cmath>
+#include <cfloat>
+#include <iostream>
+#include <new>
+#include <vector>
+
+// *nix headers
+#include <time.h>
+
+// Local headers
+#include "matrix.h"
+#include "vectorKernels.h"
+
+using namespace std;
+
+// Count heap allocations made by the whole program
+unsigned long allocationCount(0);
+
+#if __cplusplus >= 201103L
+void *operator new(size_t size)
+#else
+void *operator new(size_t size) throw(std::bad_alloc)
+#endif
+{
+	allocationCount++;
+	void *p(malloc(size > 0 ? size : 1));
+	if (!p)
+		throw std::bad_alloc();
+	return p;
+}
+
+#if __cplusplus >= 201103L
+void *operator new[](size_t size)
+#else
+void *operator new[](size_t size) throw(std::bad_alloc)
+#endif
+{
+	return operator new(size);
+}
+
+void operator delete(void *p) throw()
+{
+	free(p);
+}
+
+void operator delete[](void *p) throw()
+{
+	free(p);
+}
+
+#if __cplusplus >= 201402L
+void operator delete(void *p, size_t) throw()
+{
+	free(p);
+}
+
+void operator delete[](void *p, size_t) throw()
+{
+	free(p);
+}
+#endif
+
+double GetTime(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + now.tv_nsec * 1.0e-9;
+}
+
+bool IsClose(const Matrix &a, const Matrix &b, const double &tolerance)
+{
+	if (a.GetNumberOfRows() != b.GetNumberOfRows() ||
+		a.GetNumberOfColumns() != b.GetNumberOfColumns())
+		return false;
+
+	unsigned int i, j;
+	for (i = 0; i < a.GetNumberOfRows(); i++)
+	{
+		for (j = 0; j < a.GetNumberOfColumns(); j++)
+		{
+			if (fabs(a(i,j) - b(i,j)) > tolerance)
+				return false;
+		}
+	}
+
+	return true;
+}
+
+Matrix MultiplyScalar(const Matrix &left, const Matrix &right)
+{
+	Matrix result(left.GetNumberOfRows(), right.GetNumberOfColumns());
+	unsigned int i, j, k;
+	for (i = 0; i < result.GetNumberOfRows(); i++)
+	{
+		for (j = 0; j < result.GetNumberOfColumns(); j++)
+		{
+			for (k = 0; k < left.GetNumberOfColumns(); k++)
+				result(i,j) += left(i,k) * right(k,j);
+		}
+	}
+
+	return result;
+}
+
+bool Check(const bool &result, const char *description)
+{
+	if (!result)
+		cout << "FAILED:  " << description << endl;
+	return result;
+}
+
+bool CheckBasicOperations(void)
+{
+	const Matrix a(2, 3, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0);
+	const Matrix b(3, 2, 7.0, 8.0, 9.0, 10.0, 11.0, 12.0);
+	bool ok(true);
+
+	ok = Check(IsClose(a * b, Matrix(2, 2, 58.0, 64.0, 139.0, 154.0), 0.0),
+		"Multiplication") && ok;
+	ok = Check(IsClose(a.GetTranspose(), Matrix(3, 2, 1.0, 4.0, 2.0, 5.0, 3.0, 6.0), 0.0),
+		"Transpose") && ok;
+	ok = Check(IsClose(a + a, a * 2.0, 0.0), "Addition") && ok;
+	ok = Check(IsClose(a - a, Matrix(2, 3), 0.0), "Subtraction") && ok;
+	ok = Check(IsClose(a.GetSubMatrix(0, 1, 2, 2), Matrix(2, 2, 2.0, 3.0, 5.0, 6.0), 0.0),
+		"Sub-matrix") && ok;
+
+	Matrix c(a);
+	c.RemoveRow(0);
+	ok = Check(IsClose(c, Matrix(1, 3, 4.0, 5.0, 6.0), 0.0), "Remove row") && ok;
+
+	c = a;
+	c.RemoveColumn(1);
+	ok = Check(IsClose(c, Matrix(2, 2, 1.0, 3.0, 4.0, 6.0), 0.0), "Remove column") && ok;
+
+	c = a;
+	c.Resize(3, 2);// Same number of elements
+	c = b;
+	ok = Check(IsClose(c, b, 0.0), "Assignment after resize") && ok;
+
+	Matrix product;
+	Matrix::TransposeMultiply(a, a, product);
+	ok = Check(IsClose(product, a.GetTranspose() * a, 0.0), "Transpose multiply") && ok;
+	Matrix::Multiply(b, a, product);
+	ok = Check(IsClose(product, b * a, 0.0), "Multiply") && ok;
+
+	c = a;
+	c *= b;
+	ok = Check(IsClose(c, a * b, 0.0), "Multiplication assignment") && ok;
+
+	product = a;
+	c.Swap(product);
+	ok = Check(IsClose(c, a, 0.0) && IsClose(product, a * b, 0.0), "Swap") && ok;
+
+	Matrix inverse;
+	ok = Check(Matrix(2, 2, 4.0, 7.0, 2.0, 6.0).GetInverse(inverse) &&
+		IsClose(inverse, Matrix(2, 2, 0.6, -0.7, -0.2, 0.4), 1.0e-12), "Inverse") && ok;
+
+	// For full column rank, the pseudo-inverse is a left inverse
+	ok = Check(b.GetPsuedoInverse(inverse) &&
+		IsClose(inverse * b, Matrix::GetIdentity(2), 1.0e-12), "Pseudo-inverse") && ok;
+
+	return ok;
+}
+
+// Similar to the AutoTuner regression:  constant, temperature and heater
+// state columns
+void BuildRegression(const unsigned int &count, Matrix &A, Matrix &b)
+{
+	const Matrix x(3, 1, 0.08, 0.000625, 0.125);
+	A.Resize(count, 3);
+	unsigned int i;
+	double t;
+	for (i = 0; i < count; i++)
+	{
+		t = i * 0.5;
+		A(i,0) = 1.0;
+		A(i,1) = -(60.0 + 75.0 * (1.0 - exp(-t / 200.0)));
+		A(i,2) = 1.0 - exp(-t / 10.0) + 0.2 * sin(t / 7.0);
+	}
+
+	b = A * x;
+}
+
+bool CheckLeftDivide(void)
+{
+	Matrix A, b, x;
+	BuildRegression(200, A, b);
+	if (!Check(A.LeftDivide(b, x), "Left divide"))
+		return false;
+
+	return Check(IsClose(x, Matrix(3, 1, 0.08, 0.000625, 0.125), 1.0e-9),
+		"Least-squares solution");
+}
+
+double GetSumSquaredResiduals(const Matrix &A, const Matrix &x, const Matrix &b)
+{
+	const Matrix residual(b - A * x);
+	double sum(0.0);
+	unsigned int i;
+	for (i = 0; i < residual.GetNumberOfRows(); i++)
+		sum += residual(i,0) * residual(i,0);
+	return sum;
+}
+
+// Compares the least-squares solvers against the SVD (LeftDivide)
+bool CheckLeastSquares(void)
+{
+	bool ok(true);
+	Matrix A, b, svdX, x;
+	BuildRegression(2000, A, b);
+
+	// Add noise so there is a residual, and a second right-hand side
+	Matrix B(A.GetNumberOfRows(), 2);
+	unsigned int i;
+	for (i = 0; i < A.GetNumberOfRows(); i++)
+	{
+		B(i,0) = b(i,0) + 0.01 * sin(i * 1.7);
+		B(i,1) = A(i,1) - 2.0 * A(i,2) + 0.01 * cos(i * 0.3);
+	}
+
+	ok = Check(A.LeftDivide(B, svdX), "Left divide (multiple columns)") && ok;
+	ok = Check(A.SolveLeastSquaresQR(B, x) && IsClose(x, svdX, 1.0e-9),
+		"QR matches SVD") && ok;
+	ok = Check(A.SolveLeastSquaresCholesky(B, x) && IsClose(x, svdX, 1.0e-7),
+		"Cholesky matches SVD") && ok;
+
+	// Nearly dependent columns:  QR fits at least as well as the SVD, and
+	// Cholesky must refuse
+	Matrix nearlySingular(A);
+	for (i = 0; i < A.GetNumberOfRows(); i++)
+		nearlySingular(i,2) = A(i,0) + 1.0e-7 * A(i,2);
+	nearlySingular.LeftDivide(b, svdX);
+	ok = Check(nearlySingular.SolveLeastSquaresQR(b, x) &&
+		GetSumSquaredResiduals(nearlySingular, x, b) <=
+		GetSumSquaredResiduals(nearlySingular, svdX, b) + 1.0e-12,
+		"QR with poor conditioning") && ok;
+	ok = Check(!nearlySingular.SolveLeastSquaresCholesky(b, x),
+		"Cholesky refuses poor conditioning") && ok;
+
+	// Dependent columns
+	Matrix singular(A);
+	for (i = 0; i < A.GetNumberOfRows(); i++)
+		singular(i,2) = 2.0 * A(i,1);
+	ok = Check(!singular.SolveLeastSquaresQR(b, x), "QR detects rank deficiency") && ok;
+	ok = Check(!singular.SolveLeastSquaresCholesky(b, x),
+		"Cholesky detects rank deficiency") && ok;
+
+	// Square system has the exact solution
+	const Matrix square(2, 2, 4.0, 7.0, 2.0, 6.0);
+	ok = Check(square.SolveLeastSquaresQR(Matrix(2, 1, 1.0, 2.0), x) &&
+		IsClose(x, Matrix(2, 1, -0.8, 0.6), 1.0e-12), "QR square system") && ok;
+
+	return ok;
+}
+
+void FillTestArray(std::vector<double> &a, const unsigned int &count,
+	const double &seed)
+{
+	a.resize(count);
+	unsigned int i;
+	for (i = 0; i < count; i++)
+		a[i] = sin(seed * (i + 1)) * 100.0 + 1.0 / (i + seed);
+}
+
+double SumArray(const std::vector<double> &a, const unsigned int &count)
+{
+	double sum(0.0);
+	unsigned int i;
+	for (i = 0; i < count; i++)
+		sum += a[i];
+	return sum;
+}
+
+// Vectorized sums are accumulated in a different order, so they may differ
+// from the scalar versions by the usual bound for rounding in a sum
+bool IsWithinRounding(const double &a, const double &b, const unsigned int &count,
+	const double &sumOfMagnitudes)
+{
+	return fabs(a - b) <= (count + 1) * DBL_EPSILON * sumOfMagnitudes;
+}
+
+bool CheckVectorKernels(void)
+{
+	bool ok(true);
+	std::vector<double> a, b, y, yScalar, magnitudes;
+	const unsigned int counts[] = {0, 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 33, 1000, 100001};
+	unsigned int i, j;
+	for (i = 0; i < sizeof(counts) / sizeof(counts[0]); i++)
+	{
+		const unsigned int count(counts[i]);
+		FillTestArray(a, count, 0.37);
+		FillTestArray(b, count, 1.91);
+		a.push_back(0.0);// So &a[0] is valid for count == 0
+		b.push_back(0.0);
+
+		magnitudes.resize(count);
+		for (j = 0; j < count; j++)
+			magnitudes[j] = fabs(a[j] * b[j]);
+		ok = Check(IsWithinRounding(VectorKernels::Dot(&a[0], &b[0], count),
+			VectorKernels::DotScalar(&a[0], &b[0], count), count,
+			SumArray(magnitudes, count)), "Dot") && ok;
+
+		y = b;
+		yScalar = b;
+		VectorKernels::AddScaled(&y[0], &a[0], -0.3, count);
+		VectorKernels::AddScaledScalar(&yScalar[0], &a[0], -0.3, count);
+		for (j = 0; j < count; j++)
+		{
+			if (!IsWithinRounding(y[j], yScalar[j], 1, fabs(b[j]) + fabs(0.3 * a[j])))
+				break;
+		}
+		ok = Check(j == count, "Add scaled") && ok;
+	}
+
+	// Multiply uses the kernels; compare with a plain triple loop
+	Matrix left(37, 23), right(23, 19), vector(23, 1), result;
+	for (i = 0; i < left.GetNumberOfRows(); i++)
+	{
+		for (j = 0; j < left.GetNumberOfColumns(); j++)
+			left(i,j) = sin(i * 0.7 + j * 1.3);
+	}
+	for (i = 0; i < right.GetNumberOfRows(); i++)
+	{
+		vector(i,0) = cos(i * 0.4);
+		for (j = 0; j < right.GetNumberOfColumns(); j++)
+			right(i,j) = cos(i * 1.1 - j * 0.5);
+	}
+
+	ok = Check(IsClose(left * right, MultiplyScalar(left, right), 1.0e-13),
+		"Matrix-matrix product") && ok;
+	ok = Check(IsClose(left * vector, MultiplyScalar(left, vector), 1.0e-13),
+		"Matrix-vector product") && ok;
+
+	return ok;
+}
+
+// Passing by value copies A, as the tau search used to do
+bool SolveCopy(Matrix A, const Matrix &b, Matrix &x)
+{
+	return A.LeftDivide(b, x);
+}
+
+void Report(const char *description, const double &start,
+	const unsigned long &allocations, const unsigned int &iterations)
+{
+	cout << "  " << description << ":  " << (GetTime() - start) * 1000.0 / iterations
+		<< " msec, " << (allocationCount - allocations) / iterations
+		<< " allocations" << endl;
+}
+
+void RunBenchmark(const unsigned int &count)
+{
+	const unsigned int iterations(20);
+	Matrix A, b, x;
+	BuildRegression(count, A, b);
+
+	unsigned int i;
+	unsigned long allocations(allocationCount);
+	double start(GetTime());
+	for (i = 0; i < iterations; i++)
+		SolveCopy(A, b, x);
+	Report("Copy and left divide", start, allocations, iterations);
+
+	allocations = allocationCount;
+	start = GetTime();
+	for (i = 0; i < iterations; i++)
+		A.LeftDivide(b, x);
+	Report("Left divide", start, allocations, iterations);
+
+	allocations = allocationCount;
+	start = GetTime();
+	for (i = 0; i < iterations; i++)
+		A.SolveLeastSquaresQR(b, x);
+	Report("QR least squares", start, allocations, iterations);
+
+	allocations = allocationCount;
+	start = GetTime();
+	for (i = 0; i < iterations; i++)
+		A.SolveLeastSquaresCholesky(b, x);
+	Report("Cholesky least squares", start, allocations, iterations);
+
+	Matrix residual;
+	allocations = allocationCount;
+	start = GetTime();
+	for (i = 0; i < iterations; i++)
+		residual = b - A * x;
+	Report("Residual b - A * x", start, allocations, iterations);
+
+	Matrix normal;
+	allocations = allocationCount;
+	start = GetTime();
+	for (i = 0; i < iterations; i++)
+		normal = A.GetTranspose() * A;
+	Report("GetTranspose() * A", start, allocations, iterations);
+
+	allocations = allocationCount;
+	start = GetTime();
+	for (i = 0; i < iterations; i++)
+		Matrix::TransposeMultiply(A, A, normal);
+	Report("TransposeMultiply(A, A)", start, allocations, iterations);
+}
+
+void RunKernelBenchmark(void)
+{
+	const unsigned int count(100000), iterations(200);
+	std::vector<double> a, b;
+	FillTestArray(a, count, 0.37);
+	FillTestArray(b, count, 1.91);
+
+	unsigned int i;
+	volatile double sink;
+	double start(GetTime());
+	for (i = 0; i < iterations; i++)
+		sink = VectorKernels::Dot(&a[0], &b[0], count);
+	const double vectorDotTime((GetTime() - start) / iterations);
+
+	start = GetTime();
+	for (i = 0; i < iterations; i++)
+		sink = VectorKernels::DotScalar(&a[0], &b[0], count);
+	const double scalarDotTime((GetTime() - start) / iterations);
+
+	(void)sink;
+
+	// Alternate signs so y stays bounded
+	start = GetTime();
+	for (i = 0; i < iterations; i++)
+		VectorKernels::AddScaled(&b[0], &a[0], i % 2 == 0 ? 0.5 : -0.5, count);
+	const double vectorAddScaledTime((GetTime() - start) / iterations);
+
+	start = GetTime();
+	for (i = 0; i < iterations; i++)
+		VectorKernels::AddScaledScalar(&b[0], &a[0], i % 2 == 0 ? 0.5 : -0.5, count);
+	const double scalarAddScaledTime((GetTime() - start) / iterations);
+
+	cout << "Vector kernels (" << VectorKernels::GetInstructionSet() << "), "
+		<< count << " elements:" << endl;
+	cout << "  Dot:  " << vectorDotTime * 1.0e6 << " usec (scalar:  "
+		<< scalarDotTime * 1.0e6 << " usec)" << endl;
+	cout << "  Add scaled:  " << vectorAddScaledTime * 1.0e6 << " usec (scalar:  "
+		<< scalarAddScaledTime * 1.0e6 << " usec)" << endl;
+
+	const unsigned int size(200);
+	Matrix left(size, size), right(size, size), result;
+	unsigned int j;
+	for (i = 0; i < size; i++)
+	{
+		for (j = 0; j < size; j++)
+		{
+			left(i,j) = sin(i * 0.7 + j * 1.3);
+			right(i,j) = cos(i * 1.1 - j * 0.5);
+		}
+	}
+
+	// Build with -DVECTOR_KERNELS_SCALAR for comparison
+	const unsigned int productIterations(10);
+	start = GetTime();
+	for (i = 0; i < productIterations; i++)
+		Matrix::Multiply(left, right, result);
+	cout << "  " << size << " x " << size << " product:  "
+		<< (GetTime() - start) * 1000.0 / productIterations << " msec" << endl;
+}
+
+int main(int, char *[])
+{
+	bool ok(CheckBasicOperations());
+	ok = CheckLeftDivide() && ok;
+	ok = CheckLeastSquares() && ok;
+	ok = CheckVectorKernels() && ok;
+	if (!ok)
+		return 1;
+
+	cout << "All checks passed" << endl;
+
+	const unsigned int count(2000);
+	cout << "Regression with " << count << " rows:" << endl;
+	RunBenchmark(count);
+	RunKernelBenchmark();
+
+	return 0;
+}
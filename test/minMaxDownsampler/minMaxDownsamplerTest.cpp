@@ -0,0 +1,204 @@
+// File:  minMaxDownsamplerTest.cpp
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Copy:  (c) Copyright 2026
+// Desc:  Application for testing the MinMaxDownsampler class.  Checks that
+//        single-sample spikes survive repeated bucket merges and that the
+//        output stays ordered and within GetMaximumPointCount(), then times
+//        a redraw of a plot-sized run, as PlotWorker does.
+
+// Standard C++ headers
+#include <cstdlib>
+#include <iostream>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+
+// *nix headers
+#include <time.h>
+
+// Local headers
+#include "minMaxDownsampler.h"
+#include "chartRenderer.h"
+
+using namespace std;
+
+double GetTime(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + now.tv_nsec * 1.0e-9;
+}
+
+bool Check(const bool &result, const char *description)
+{
+	if (!result)
+		cout << "FAILED:  " << description << endl;
+	return result;
+}
+
+bool IsNonDecreasing(const std::vector<double> &x)
+{
+	unsigned int i;
+	for (i = 1; i < x.size(); i++)
+	{
+		if (x[i] < x[i - 1])
+			return false;
+	}
+
+	return true;
+}
+
+// True if the series contains the point (x, y)
+bool Contains(const std::vector<double> &x, const std::vector<double> &y,
+	const double &xValue, const double &yValue)
+{
+	unsigned int i;
+	for (i = 0; i < x.size(); i++)
+	{
+		if (x[i] == xValue && y[i] == yValue)
+			return true;
+	}
+
+	return false;
+}
+
+// A flat, slightly noisy series with one high and one low single-sample spike;
+// the output is checked after every sample, so every merge (which reads
+// buckets 2i and 2i + 1 while writing bucket i) is covered
+bool CheckSpikes(const unsigned int &bucketCount)
+{
+	const unsigned int sampleCount(5000);
+	const unsigned int highIndex(137), lowIndex(2890);
+	MinMaxDownsampler downsampler(bucketCount);
+	std::vector<double> x, y;
+	x.reserve(downsampler.GetMaximumPointCount());
+	y.reserve(downsampler.GetMaximumPointCount());
+
+	bool ordered(true), bounded(true), highKept(true), lowKept(true);
+	unsigned int i;
+	for (i = 0; i < sampleCount; i++)
+	{
+		double value(0.01 * sin(i * 0.7));
+		if (i == highIndex)
+			value = 100.0;
+		else if (i == lowIndex)
+			value = -100.0;
+		downsampler.Add(i * 0.1, value);
+
+		downsampler.GetSeries(x, y);
+		ordered = ordered && IsNonDecreasing(x);
+		bounded = bounded && x.size() <= downsampler.GetMaximumPointCount() &&
+			x.size() == y.size();
+		if (i >= highIndex)
+			highKept = highKept && Contains(x, y, highIndex * 0.1, 100.0);
+		if (i >= lowIndex)
+			lowKept = lowKept && Contains(x, y, lowIndex * 0.1, -100.0);
+	}
+
+	cout << "  " << bucketCount << " buckets:  " << x.size() << " points for "
+		<< downsampler.GetSampleCount() << " samples" << endl;
+
+	bool ok(Check(ordered, "Output x-values are non-decreasing"));
+	ok = Check(bounded, "Point count is within GetMaximumPointCount()") && ok;
+	ok = Check(highKept, "High spike survives every merge") && ok;
+	ok = Check(lowKept, "Low spike survives every merge") && ok;
+
+	downsampler.Reset();
+	downsampler.GetSeries(x, y);
+	ok = Check(x.empty() && downsampler.GetSampleCount() == 0,
+		"Reset discards all samples") && ok;
+
+	return ok;
+}
+
+// Until the first merge, every sample is its own bucket
+bool CheckNoMerge(void)
+{
+	const unsigned int bucketCount(8);
+	MinMaxDownsampler downsampler(bucketCount);
+	std::vector<double> x, y;
+
+	unsigned int i;
+	for (i = 0; i < bucketCount - 1; i++)
+		downsampler.Add(i, i * i);
+
+	downsampler.GetSeries(x, y);
+	bool ok(x.size() == bucketCount - 1);
+	for (i = 0; ok && i < x.size(); i++)
+		ok = x[i] == i && y[i] == i * i;
+
+	return Check(ok, "All samples are returned before the first merge");
+}
+
+// Two temperature channels sampled at 10 Hz (about 2.8 hours), downsampled
+// and drawn with the same settings as PlotWorker
+void TimeRedraw(void)
+{
+	const unsigned int bucketCount(800);
+	const unsigned int sampleCount(100000);
+	MinMaxDownsampler commanded(bucketCount), actual(bucketCount);
+	std::vector<double> commandedTime, commandedValue, actualTime, actualValue;
+	commandedTime.reserve(commanded.GetMaximumPointCount());
+	commandedValue.reserve(commanded.GetMaximumPointCount());
+	actualTime.reserve(actual.GetMaximumPointCount());
+	actualValue.reserve(actual.GetMaximumPointCount());
+
+	unsigned int i;
+	double start(GetTime());
+	for (i = 0; i < sampleCount; i++)
+	{
+		const double time(i * 0.1 / 60.0);// [min]
+		commanded.Add(time, std::min(70.0 + 2.0 * time, 140.0));
+		actual.Add(time, std::min(68.0 + 2.0 * time, 140.0) + 0.5 * sin(i * 0.05));
+	}
+	const double addTime(GetTime() - start);
+
+	ChartRenderer chart;
+	chart.SetTitle("Temperature History");
+	chart.SetXLabel("Time [min]");
+	chart.SetYLabel("Temperature [deg F]");
+	chart.SetXRange(0.0, (sampleCount - 1) * 0.1 / 60.0);
+	chart.SetYRange(60.0, 150.0);
+	chart.AddSeries(commandedTime, commandedValue, "Commanded", "red");
+	chart.AddSeries(actualTime, actualValue, "Actual", "blue");
+
+	const unsigned int iterations(100);
+	start = GetTime();
+	for (i = 0; i < iterations; i++)
+	{
+		commanded.GetSeries(commandedTime, commandedValue);
+		actual.GetSeries(actualTime, actualValue);
+		if (!chart.Render("minMaxDownsamplerTest.svg"))
+		{
+			cout << "Failed to render chart" << endl;
+			return;
+		}
+	}
+	const double redrawTime((GetTime() - start) / iterations);
+
+	cout << "Added " << sampleCount << " samples to each of two series in "
+		<< addTime * 1.0e3 << " msec (" << addTime * 1.0e9 / (2 * sampleCount)
+		<< " nsec/sample)" << endl;
+	cout << "Redrew " << actualTime.size() << " points per series in "
+		<< redrawTime * 1.0e3 << " msec (average of " << iterations
+		<< " redraws)" << endl;
+}
+
+// Application entry point
+int main(int, char *[])
+{
+	cout << "Spikes:" << endl;
+	bool ok(CheckSpikes(2));
+	ok = CheckSpikes(8) && ok;
+	ok = CheckSpikes(800) && ok;
+	ok = CheckNoMerge() && ok;
+	if (!ok)
+		return 1;
+
+	cout << "All checks passed" << endl;
+
+	TimeRedraw();
+
+	return 0;
+}
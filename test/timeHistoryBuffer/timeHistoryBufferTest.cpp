@@ -0,0 +1,349 @@
+// File:  timeHistoryBufferTest.cpp
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Copy:  (c) Copyright 2026
+// Desc:  Application for testing the TimeHistoryBuffer class.  Checks
+//        wraparound, Clear() and the bounds of GetWindow() from a single
+//        thread, then runs one writer thread against several reader threads
+//        and checks that readers never see a partially written sample.
+
+// Standard C++ headers
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+// *nix headers
+#include <pthread.h>
+#include <time.h>
+
+// Local headers
+#include "timeHistoryBuffer.h"
+
+using namespace std;
+
+double GetTime(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + now.tv_nsec * 1.0e-9;
+}
+
+bool Check(const bool &result, const char *description)
+{
+	if (!result)
+		cout << "FAILED:  " << description << endl;
+	return result;
+}
+
+// Every field is derived from the index, so a sample mixing fields from two
+// different writes can be detected
+TimeHistoryBuffer::Sample MakeSample(const unsigned long &index)
+{
+	TimeHistoryBuffer::Sample sample;
+	sample.time = index;
+	sample.commandedTemperature = index + 1.0;
+	sample.actualTemperature = index + 2.0;
+	sample.pwmDuty = index + 3.0;
+	sample.proportionalTerm = index + 4.0;
+	sample.integralTerm = index + 5.0;
+	sample.derivativeTerm = index + 6.0;
+	sample.feedForwardTerm = index + 7.0;
+	sample.state = static_cast<int>(index % 7);
+	return sample;
+}
+
+bool IsConsistent(const TimeHistoryBuffer::Sample &sample)
+{
+	const TimeHistoryBuffer::Sample expected(MakeSample(
+		static_cast<unsigned long>(sample.time)));
+	return sample.time == expected.time &&
+		sample.commandedTemperature == expected.commandedTemperature &&
+		sample.actualTemperature == expected.actualTemperature &&
+		sample.pwmDuty == expected.pwmDuty &&
+		sample.proportionalTerm == expected.proportionalTerm &&
+		sample.integralTerm == expected.integralTerm &&
+		sample.derivativeTerm == expected.derivativeTerm &&
+		sample.feedForwardTerm == expected.feedForwardTerm &&
+		sample.state == expected.state;
+}
+
+// True if count samples were returned, with indices first, first + 1, ...
+bool IsSequence(const TimeHistoryBuffer::Sample *samples,
+	const unsigned int &count, const unsigned int &expectedCount,
+	const unsigned long &first)
+{
+	if (count != expectedCount)
+		return false;
+
+	unsigned int i;
+	for (i = 0; i < count; i++)
+	{
+		if (samples[i].time != first + i || !IsConsistent(samples[i]))
+			return false;
+	}
+
+	return true;
+}
+
+void AddSamples(TimeHistoryBuffer &buffer, const unsigned long &first,
+	const unsigned long &count)
+{
+	unsigned long i;
+	for (i = first; i < first + count; i++)
+		buffer.Add(MakeSample(i));
+}
+
+bool CheckWraparound(void)
+{
+	const unsigned int capacity(10);
+	TimeHistoryBuffer buffer(capacity);
+	TimeHistoryBuffer::Sample samples[2 * capacity], sample;
+	bool ok(true);
+
+	ok = Check(buffer.GetLatest(samples, capacity) == 0 &&
+		!buffer.GetMostRecent(sample), "Empty buffer returns no samples") && ok;
+
+	AddSamples(buffer, 0, 4);
+	ok = Check(IsSequence(samples, buffer.GetLatest(samples, capacity), 4, 0),
+		"Partially filled buffer") && ok;
+	ok = Check(IsSequence(samples, buffer.GetLatest(samples, 2), 2, 2),
+		"GetLatest returns the most recent maxCount samples") && ok;
+
+	AddSamples(buffer, 4, 21);
+	ok = Check(buffer.GetTotalCount() == 25, "Total count includes overwritten samples") && ok;
+	ok = Check(IsSequence(samples, buffer.GetLatest(samples, 2 * capacity), capacity, 15),
+		"Wrapped buffer keeps the most recent samples") && ok;
+	ok = Check(buffer.GetMostRecent(sample) && sample.time == 24.0 && IsConsistent(sample),
+		"GetMostRecent after wrapping") && ok;
+
+	// Exactly full, at the wrap point
+	TimeHistoryBuffer fullBuffer(capacity);
+	AddSamples(fullBuffer, 0, capacity);
+	ok = Check(IsSequence(samples, fullBuffer.GetLatest(samples, 2 * capacity), capacity, 0),
+		"Exactly full buffer") && ok;
+
+	return ok;
+}
+
+bool CheckClear(void)
+{
+	const unsigned int capacity(10);
+	TimeHistoryBuffer buffer(capacity);
+	TimeHistoryBuffer::Sample samples[capacity], sample;
+	bool ok(true);
+
+	buffer.Clear();
+	ok = Check(buffer.GetLatest(samples, capacity) == 0, "Clearing an empty buffer") && ok;
+
+	AddSamples(buffer, 0, 25);
+	buffer.Clear();
+	ok = Check(buffer.GetLatest(samples, capacity) == 0 && !buffer.GetMostRecent(sample),
+		"Cleared buffer returns no samples") && ok;
+	ok = Check(buffer.GetWindow(0.0, 100.0, samples, capacity) == 0,
+		"Cleared samples are not in any window") && ok;
+	ok = Check(buffer.GetTotalCount() == 25, "Clear does not change the total count") && ok;
+
+	AddSamples(buffer, 25, 3);
+	ok = Check(IsSequence(samples, buffer.GetLatest(samples, capacity), 3, 25),
+		"Only samples added after Clear are returned") && ok;
+	ok = Check(IsSequence(samples, buffer.GetWindow(0.0, 100.0, samples, capacity), 3, 25),
+		"Window excludes cleared samples") && ok;
+
+	// Once the cleared samples are overwritten, the buffer is full again
+	AddSamples(buffer, 28, 12);
+	ok = Check(IsSequence(samples, buffer.GetLatest(samples, capacity), capacity, 30),
+		"Buffer refills after Clear") && ok;
+
+	return ok;
+}
+
+bool CheckWindow(void)
+{
+	const unsigned int capacity(10);
+	TimeHistoryBuffer buffer(capacity);
+	TimeHistoryBuffer::Sample samples[capacity];
+	bool ok(true);
+
+	ok = Check(buffer.GetWindow(0.0, 100.0, samples, capacity) == 0,
+		"Window of an empty buffer") && ok;
+
+	AddSamples(buffer, 0, 25);// Times 15 to 24 remain
+
+	ok = Check(IsSequence(samples, buffer.GetWindow(17.0, 20.0, samples, capacity), 4, 17),
+		"Window includes both end points") && ok;
+	ok = Check(IsSequence(samples, buffer.GetWindow(16.5, 19.5, samples, capacity), 3, 17),
+		"Window between samples") && ok;
+	ok = Check(IsSequence(samples, buffer.GetWindow(0.0, 16.0, samples, capacity), 2, 15),
+		"Window starting before the oldest sample") && ok;
+	ok = Check(IsSequence(samples, buffer.GetWindow(22.0, 100.0, samples, capacity), 3, 22),
+		"Window ending after the newest sample") && ok;
+	ok = Check(IsSequence(samples, buffer.GetWindow(20.0, 20.0, samples, capacity), 1, 20),
+		"Window containing one sample") && ok;
+	ok = Check(buffer.GetWindow(0.0, 14.0, samples, capacity) == 0,
+		"Window before the oldest sample") && ok;
+	ok = Check(buffer.GetWindow(24.5, 100.0, samples, capacity) == 0,
+		"Window after the newest sample") && ok;
+	ok = Check(buffer.GetWindow(20.0, 18.0, samples, capacity) == 0,
+		"Window with start after end") && ok;
+	ok = Check(IsSequence(samples, buffer.GetWindow(0.0, 100.0, samples, 4), 4, 15),
+		"Window longer than maxCount returns the oldest samples") && ok;
+	ok = Check(buffer.GetWindow(0.0, 100.0, samples, 0) == 0,
+		"Window with maxCount of zero") && ok;
+
+	return ok;
+}
+
+// Shared between the stress test threads
+struct StressData
+{
+	StressData(const unsigned int &capacity) : buffer(capacity) {}
+
+	TimeHistoryBuffer buffer;
+	unsigned long sampleCount;
+	volatile bool writerDone;
+};
+
+struct ReaderResult
+{
+	StressData *data;
+	unsigned long readCount;// Samples returned
+	unsigned long errorCount;// Inconsistent samples or out of order
+};
+
+void *WriterThread(void *pData)
+{
+	StressData &data(*static_cast<StressData*>(pData));
+	unsigned long i;
+	for (i = 0; i < data.sampleCount; i++)
+	{
+		data.buffer.Add(MakeSample(i));
+
+		// Clear occasionally, as at the start of a cook
+		if (i % 100000 == 50000)
+			data.buffer.Clear();
+	}
+
+	data.writerDone = true;
+	return NULL;
+}
+
+// Samples must be internally consistent, in increasing order, and within
+// the requested window
+unsigned long CountErrors(const TimeHistoryBuffer::Sample *samples,
+	const unsigned int &count, const double &startTime, const double &endTime)
+{
+	unsigned long errors(0);
+	unsigned int i;
+	for (i = 0; i < count; i++)
+	{
+		if (!IsConsistent(samples[i]) ||
+			samples[i].time < startTime || samples[i].time > endTime ||
+			(i > 0 && samples[i].time <= samples[i - 1].time))
+			errors++;
+	}
+
+	return errors;
+}
+
+void *ReaderThread(void *pResult)
+{
+	ReaderResult &result(*static_cast<ReaderResult*>(pResult));
+	TimeHistoryBuffer &buffer(result.data->buffer);
+	vector<TimeHistoryBuffer::Sample> samples(buffer.GetCapacity());
+	TimeHistoryBuffer::Sample sample;
+	unsigned int count, pass(0);
+
+	while (!result.data->writerDone)
+	{
+		count = buffer.GetLatest(&samples.front(), samples.size());
+		result.readCount += count;
+		result.errorCount += CountErrors(&samples.front(), count, 0.0, 1.0e12);
+
+		if (buffer.GetMostRecent(sample))
+		{
+			result.readCount++;
+			if (!IsConsistent(sample))
+				result.errorCount++;
+
+			// A window near the oldest samples, which are being overwritten
+			const double endTime(sample.time - samples.size() / 2);
+			const double startTime(endTime - (pass++ % samples.size()));
+			count = buffer.GetWindow(startTime, endTime, &samples.front(), samples.size());
+			result.readCount += count;
+			result.errorCount += CountErrors(&samples.front(), count, startTime, endTime);
+		}
+	}
+
+	return NULL;
+}
+
+bool RunStressTest(const unsigned int &capacity, const unsigned long &sampleCount)
+{
+	const unsigned int readerCount(3);
+	StressData data(capacity);
+	data.sampleCount = sampleCount;
+	data.writerDone = false;
+
+	ReaderResult results[readerCount];
+	pthread_t readers[readerCount], writer;
+	unsigned int i;
+	const double start(GetTime());
+	for (i = 0; i < readerCount; i++)
+	{
+		results[i].data = &data;
+		results[i].readCount = 0;
+		results[i].errorCount = 0;
+		if (pthread_create(&readers[i], NULL, &ReaderThread, &results[i]) != 0)
+		{
+			cout << "Failed to create reader thread" << endl;
+			exit(1);
+		}
+	}
+
+	if (pthread_create(&writer, NULL, &WriterThread, &data) != 0)
+	{
+		cout << "Failed to create writer thread" << endl;
+		exit(1);
+	}
+
+	pthread_join(writer, NULL);
+	unsigned long readCount(0), errorCount(0);
+	for (i = 0; i < readerCount; i++)
+	{
+		pthread_join(readers[i], NULL);
+		readCount += results[i].readCount;
+		errorCount += results[i].errorCount;
+	}
+
+	cout << "  Capacity " << capacity << ":  " << sampleCount << " samples written, "
+		<< readCount << " read by " << readerCount << " threads in "
+		<< GetTime() - start << " sec, " << errorCount << " errors" << endl;
+
+	TimeHistoryBuffer::Sample sample;
+	return Check(errorCount == 0, "Readers saw only complete samples, in order") &&
+		Check(data.buffer.GetMostRecent(sample) && sample.time == sampleCount - 1,
+		"Final sample is the last one written");
+}
+
+// Application entry point
+int main(int, char *[])
+{
+	bool ok(CheckWraparound());
+	ok = CheckClear() && ok;
+	ok = CheckWindow() && ok;
+	if (!ok)
+		return 1;
+
+	cout << "All single-thread checks passed" << endl;
+
+	// A small buffer makes the writer overwrite slots while they are read
+	cout << "Concurrent writer and readers:" << endl;
+	ok = RunStressTest(16, 5000000) && ok;
+	ok = RunStressTest(1000, 5000000) && ok;
+	if (!ok)
+		return 1;
+
+	cout << "All checks passed" << endl;
+
+	return 0;
+}
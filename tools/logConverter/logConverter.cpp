@@ -0,0 +1,100 @@
+// File:  logConverter.cpp
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Copy:  (c) Copyright 2026
+// Desc:  Command line tool for converting binary time history logs into CSV
+//        files (first line is column names, second line is units).
+
+// Standard C++ headers
+#include <cstdlib>
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <string>
+
+// Local headers
+#include "binaryLogReader.h"
+
+using namespace std;
+
+const streamsize timePrecision(10);
+const streamsize valuePrecision(7);// Values are stored as single-precision floats
+
+string GetDefaultOutputName(const string &inputName)
+{
+	const string::size_type dot(inputName.find_last_of('.'));
+	const string::size_type slash(inputName.find_last_of('/'));
+	if (dot == string::npos || (slash != string::npos && dot < slash))
+		return inputName + ".csv";
+	return inputName.substr(0, dot) + ".csv";
+}
+
+bool WriteCSV(const BinaryLogReader &reader, const string &fileName)
+{
+	ofstream file(fileName.c_str(), ios::out);
+	if (!file.is_open() || !file.good())
+	{
+		cerr << "Failed to open '" << fileName << "' for output" << endl;
+		return false;
+	}
+
+	unsigned int i, j;
+	for (i = 0; i < reader.GetColumnCount(); i++)
+		file << (i > 0 ? "," : "") << reader.GetColumnName(i);
+	file << '\n';
+
+	for (i = 0; i < reader.GetColumnCount(); i++)
+		file << (i > 0 ? "," : "") << reader.GetColumnUnits(i);
+	file << '\n';
+
+	for (j = 0; j < reader.GetRecordCount(); j++)
+	{
+		file << setprecision(timePrecision) << reader.GetColumn(0)[j]
+			<< setprecision(valuePrecision);
+		for (i = 1; i < reader.GetColumnCount(); i++)
+			file << ',' << reader.GetColumn(i)[j];
+		file << '\n';
+	}
+
+	file.flush();
+	if (!file.good())
+	{
+		cerr << "Failed to write '" << fileName << "'" << endl;
+		return false;
+	}
+
+	return true;
+}
+
+int main(int argc, char *argv[])
+{
+	if (argc < 2 || argc > 3)
+	{
+		cout << "Usage:  " << argv[0] << " <binary log> [<output CSV file>]" << endl;
+		cout << "If no output file is specified, the log's extension is replaced with .csv" << endl;
+		return 1;
+	}
+
+	const string inputName(argv[1]);
+	string outputName;
+	if (argc == 3)
+		outputName = argv[2];
+	else
+		outputName = GetDefaultOutputName(inputName);
+
+	BinaryLogReader reader(cerr);
+	if (!reader.Read(inputName))
+		return 1;
+
+	if (!WriteCSV(reader, outputName))
+		return 1;
+
+	cout << "Wrote " << reader.GetRecordCount() << " records to '"
+		<< outputName << "'" << endl;
+
+	// Let scripts know that the output is incomplete
+	if (reader.IsDamaged())
+		return 2;
+
+	return 0;
+}